@@ -0,0 +1,40 @@
+/** \file */
+
+#include "led.h"
+
+/* ATTRIBUTES
+ * ==========
+ */
+
+/** \brief Emulated LED status */
+static bool pv_ledOn;
+
+/* OPERATIONS
+ * ==========
+ */
+
+/** \brief Print emulated LED status to console */
+static void pv_print(void) {
+    (void)printf("LED %s\n", (true == pv_ledOn) ? "on" : "off");
+    (void)fflush(stdout);
+}
+
+void led_init(void) {
+    pv_ledOn = false;
+    pv_print();
+}
+
+void led_on(void) {
+    pv_ledOn = true;
+    pv_print();
+}
+
+void led_off(void) {
+    pv_ledOn = false;
+    pv_print();
+}
+
+void led_toggle(void) {
+    pv_ledOn = !pv_ledOn;
+    pv_print();
+}
@@ -0,0 +1,27 @@
+/** \file */
+
+#ifndef LED_H
+#define LED_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <stdio.h> /* Provides console output (LED is emulated) */
+
+/* OPERATIONS
+ * ==========
+ */
+
+/** \brief Init. emulated LED (printed to console) */
+void led_init(void);
+
+/** \brief Turn LED on */
+void led_on(void);
+
+/** \brief Turn LED off */
+void led_off(void);
+
+/** \brief Toggle LED status from "off" to "on" and vice versa */
+void led_toggle(void);
+
+#endif /* LED_H */
@@ -30,6 +30,10 @@ int MAIN(void) {
 
     do { /* Endless "super loop" */
         TKLsdlr_exec(); /* Scheduling algorithm exec. cycle */
+
+        /* Tickless idle:  Sleep until next task release (returns immediately
+           if a task is due already) */
+        TKLtick_sleep(&TKLsdlr_cntTickToNextRel);
     } while (TESTABLE_ENDLESSLOOP_CONDITION);
 
 #ifdef TEST
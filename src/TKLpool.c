@@ -0,0 +1,87 @@
+/** \file */
+
+#include "TKLpool.h"
+
+/* OPERATIONS
+ * ==========
+ */
+
+void* TKLpool_alloc(TKLpool_t* const me) {
+    /* Sanity check (Design by Contract) */
+    assert((NULL != me->p_buf) &&
+           (0u < me->blkSize) &&
+           (0u < me->blkCnt) &&
+           (UINT8_MAX > me->blkCnt));
+
+    uint8_t* const p_buf = me->p_buf;
+    uint8_t* p_blk = NULL;
+
+    TKLCS1_INIT();
+
+    TKLCS1_ENTER();
+    if (0u != me->freeHead) { /* Freed block available? */
+        p_blk = &p_buf[(size_t)(me->freeHead - 1u) * me->blkSize];
+        me->freeHead = *p_blk; /* Unlink (link stored within free block) */
+    } else if (0u != me->initCnt) { /* Never allocated block available? */
+        p_blk = &p_buf[(size_t)(me->blkCnt - me->initCnt) * me->blkSize];
+        me->initCnt--;
+    } else {
+        /* Do nothing (all blocks allocated) */
+    }
+
+    if (NULL != p_blk) {
+        me->useCnt++;
+        if (me->useCnt > me->useMax) { /* New high-water mark? */
+            me->useMax = me->useCnt;
+        }
+    } else if (UINT8_MAX > me->failCnt) { /* Counter unsaturated? */
+        me->failCnt++;
+    } else {
+        /* Do nothing (fail counter saturated) */
+    }
+    TKLCS1_EXIT();
+
+    return (p_blk);
+}
+
+void TKLpool_free(TKLpool_t* const me, void* const p_blk) {
+    uint8_t* const p_buf = me->p_buf;
+    const size_t ofs = (size_t)((uint8_t*)p_blk - p_buf);
+
+    /* Sanity check (Design by Contract); block must be from this pool and
+       must have been allocated */
+    assert((NULL != p_blk) &&
+           ((uint8_t*)p_blk >= p_buf) &&
+           (ofs < (me->blkCnt * me->blkSize)) &&
+           (0u == (ofs % me->blkSize)) &&
+           (0u < me->useCnt));
+
+    TKLCS1_INIT();
+
+    TKLCS1_ENTER();
+    *(uint8_t*)p_blk = me->freeHead; /* Link block into free list */
+    me->freeHead = (uint8_t)(ofs / me->blkSize + 1u);
+    me->useCnt--;
+    TKLCS1_EXIT();
+}
+
+uint8_t TKLpool_cntUsed(const TKLpool_t* const me) {
+    return (me->useCnt);
+}
+
+uint8_t TKLpool_getUseMax(const TKLpool_t* const me) {
+    return (me->useMax);
+}
+
+uint8_t TKLpool_cntFail(const TKLpool_t* const me) {
+    return (me->failCnt);
+}
+
+void TKLpool_clrStat(TKLpool_t* const me) {
+    TKLCS1_INIT();
+
+    TKLCS1_ENTER();
+    me->useMax = me->useCnt;
+    me->failCnt = 0u;
+    TKLCS1_EXIT();
+}
@@ -0,0 +1,130 @@
+/** \file */
+
+#ifndef TKLPOOL_H
+#define TKLPOOL_H
+
+/* `"` used intentionally.  This allows the user to override and provide his
+   own implementation before falling back to libc. */
+#include "stdint.h"
+#include "stddef.h"
+#include "stdbool.h"
+#include "assert.h" /* For sanity checks (Design by Contract) */
+
+#include "TKLcs1.h"
+
+/* ATTRIBUTES
+ * ==========
+ */
+
+/**
+ * \brief Fixed-block memory pool
+ *
+ * Free blocks form a singly linked list (the link is stored within the free
+ * block itself), so that allocating and freeing a block is O(1).  Blocks that
+ * were never allocated are handed out in order, so that a pool needs no
+ * initialization at run time.  Define via \ref TKLPOOL_DEF().
+ */
+typedef struct {
+    /** \brief Blocks */
+    void* const p_buf;
+    /** \brief Size of one block in bytes */
+    const size_t blkSize;
+    /** \brief Number of blocks (max. `254`) */
+    const uint8_t blkCnt;
+    /** \brief First free block of free list (index + 1, `0` if none) */
+    uint8_t freeHead;
+    /** \brief Number of blocks never allocated so far */
+    uint8_t initCnt;
+    /** \brief Number of allocated blocks */
+    volatile uint8_t useCnt;
+    /** \brief Max. number of allocated blocks (high-water mark) */
+    volatile uint8_t useMax;
+    /** \brief Number of failed allocations (saturating) */
+    volatile uint8_t failCnt;
+} TKLpool_t;
+
+/**
+ * \brief Statically define fixed-block memory pool
+ *
+ * E.g.:
+ *
+ *     typedef uint8_t APP_buf_t[64];
+ *
+ *     TKLPOOL_DEF(static, pv_bufPool, APP_buf_t, 8u);
+ *
+ * `sc_` is the storage class specifier of the definitions (may be empty).
+ * Defines the block array `<name_>Buf` (aligned for the block type `typ_`)
+ * and the pool `name_` referencing it.
+ */
+#define TKLPOOL_DEF(sc_, name_, typ_, blkCnt_) \
+    sc_ typ_ name_##Buf[blkCnt_]; \
+    sc_ TKLpool_t name_ = {name_##Buf, sizeof(typ_), (blkCnt_), 0u, \
+                           (blkCnt_), 0u, 0u, 0u}
+
+/* OPERATIONS
+ * ==========
+ */
+
+/**
+ * \brief Allocate block
+ *
+ * May be called from ISRs (the pool is protected by a short critical section
+ * via \ref TKLCS1_ENTER()).
+ *
+ * \param me Memory pool
+ *
+ * \return Allocated block, `NULL` if all blocks are allocated
+ */
+void* TKLpool_alloc(TKLpool_t* const me);
+
+/**
+ * \brief Free block allocated previously
+ *
+ * May be called from ISRs (the pool is protected by a short critical section
+ * via \ref TKLCS1_ENTER()).
+ *
+ * \param me Memory pool
+ * \param p_blk Block allocated from this pool
+ */
+void TKLpool_free(TKLpool_t* const me, void* const p_blk);
+
+/**
+ * \brief Get number of allocated blocks
+ *
+ * \param me Memory pool
+ *
+ * \return Number of allocated blocks
+ */
+uint8_t TKLpool_cntUsed(const TKLpool_t* const me);
+
+/**
+ * \brief Get max. number of blocks allocated at the same time (high-water
+ * mark)
+ *
+ * E.g., to size the pool to the actually needed RAM.
+ *
+ * \param me Memory pool
+ *
+ * \return Max. number of allocated blocks since definition or last clear
+ */
+uint8_t TKLpool_getUseMax(const TKLpool_t* const me);
+
+/**
+ * \brief Get number of failed allocations because all blocks were allocated
+ *
+ * \param me Memory pool
+ *
+ * \return Number of failed allocations (saturates at `UINT8_MAX`)
+ */
+uint8_t TKLpool_cntFail(const TKLpool_t* const me);
+
+/**
+ * \brief Clear high-water mark and failed allocation counter
+ *
+ * The high-water mark restarts at the current number of allocated blocks.
+ *
+ * \param me Memory pool
+ */
+void TKLpool_clrStat(TKLpool_t* const me);
+
+#endif /* TKLPOOL_H */
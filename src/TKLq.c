@@ -0,0 +1,102 @@
+/** \file */
+
+#include "TKLq.h"
+
+/* OPERATIONS
+ * ==========
+ */
+
+/**
+ * \brief Get message slot of free-running index
+ *
+ * \param me Message queue
+ * \param idx Free-running index (\ref TKLq_t::head or \ref TKLq_t::tail)
+ *
+ * \return Message slot
+ */
+static void* pv_slot(const TKLq_t* const me, const uint8_t idx) {
+    return ((uint8_t*)me->p_buf +
+            (size_t)(idx & (uint8_t)(me->slotCnt - 1u)) * me->slotSize);
+}
+
+void* TKLq_reserve(TKLq_t* const me) {
+    /* Sanity check (Design by Contract) */
+    assert((NULL != me->p_buf) &&
+           (2u <= me->slotCnt) &&
+           (128u >= me->slotCnt) &&
+           (0u == (me->slotCnt & (me->slotCnt - 1u))));
+
+    const uint8_t head = me->head;
+    void* p_slot = NULL;
+
+    /* Free slot? */
+    if (me->slotCnt > (uint8_t)(head - me->tail)) {
+        TKLSDLR_BARRIER(); /* Check for free slot before writing it */
+        p_slot = pv_slot(me, head);
+    } else if (UINT8_MAX > me->dropCnt) { /* Counter unsaturated? */
+        me->dropCnt++;
+    } else {
+        /* Do nothing (drop counter saturated) */
+    }
+
+    return (p_slot);
+}
+
+void TKLq_commit(TKLq_t* const me) {
+    const uint8_t head = me->head;
+
+    /* Sanity check (Design by Contract); slot must have been reserved prev. */
+    assert(me->slotCnt > (uint8_t)(head - me->tail));
+
+    TKLSDLR_BARRIER();
+    me->head = (uint8_t)(head + 1u); /* Publish message after writing */
+
+#if TKLSDLRCFG_EVT_ENA
+    if (TKLQ_TSK_NONE != me->relTsk) { /* Consuming task to release? */
+        if (NULL == me->p_sdlr) {
+            TKLsdlr_postEvt(me->relTsk);
+        } else {
+            TKLsdlr_ctxPostEvt(me->p_sdlr, me->relTsk);
+        }
+    }
+#endif /* TKLSDLRCFG_EVT_ENA */
+}
+
+const void* TKLq_peek(TKLq_t* const me) {
+    const uint8_t tail = me->tail;
+    const void* p_slot = NULL;
+
+    if (tail != me->head) { /* Message available? */
+        TKLSDLR_BARRIER(); /* Check for message before reading it */
+        p_slot = pv_slot(me, tail);
+    }
+
+    return (p_slot);
+}
+
+void TKLq_release(TKLq_t* const me) {
+    const uint8_t tail = me->tail;
+
+    /* Sanity check (Design by Contract); message must be available */
+    assert(tail != me->head);
+
+    TKLSDLR_BARRIER();
+    me->tail = (uint8_t)(tail + 1u); /* Free slot after reading */
+}
+
+uint8_t TKLq_cnt(const TKLq_t* const me) {
+    return ((uint8_t)(me->head - me->tail));
+}
+
+uint8_t TKLq_cntDrop(const TKLq_t* const me) {
+    return (me->dropCnt);
+}
+
+#if TKLSDLRCFG_EVT_ENA
+void TKLq_setRelTsk(TKLq_t* const me,
+                    TKLsdlr_ctx_t* const p_sdlr,
+                    const uint8_t tskIdx) {
+    me->p_sdlr = p_sdlr;
+    me->relTsk = tskIdx;
+}
+#endif /* TKLSDLRCFG_EVT_ENA */
@@ -0,0 +1,161 @@
+/** \file */
+
+#ifndef TKLQ_H
+#define TKLQ_H
+
+/* `"` used intentionally.  This allows the user to override and provide his
+   own implementation before falling back to libc. */
+#include "stdint.h"
+#include "stddef.h"
+#include "stdbool.h"
+#include "assert.h" /* For sanity checks (Design by Contract) */
+
+#include "TKLsdlr.h"
+
+/* ATTRIBUTES
+ * ==========
+ */
+
+/** \brief Marker for no task to release on message commit */
+#define TKLQ_TSK_NONE UINT8_MAX
+
+/**
+ * \brief Lock-free single-producer/single-consumer message queue
+ *
+ * Ring buffer of fixed-size message slots that are written and read in place
+ * (zero-copy).  Only the producer writes `head` and only the consumer writes
+ * `tail` (both free-running), so neither side needs a critical section.
+ * Slots are ordered against the indices by compiler barriers only (see
+ * \ref TKLSDLR_BARRIER()):  Producer and consumer (e.g., an ISR and a task)
+ * must run on the same core;  the queue is not safe across cores or threads.
+ * Define via \ref TKLQ_DEF().
+ */
+typedef struct {
+    /** \brief Message slots */
+    void* const p_buf;
+    /** \brief Size of one message slot in bytes */
+    const size_t slotSize;
+    /** \brief Number of message slots (power of 2 in range `[2, 128]`) */
+    const uint8_t slotCnt;
+    /** \brief Number of committed messages (written by producer only) */
+    volatile uint8_t head;
+    /** \brief Number of released messages (written by consumer only) */
+    volatile uint8_t tail;
+    /**
+     * \brief Number of messages dropped because queue was full (written by
+     * producer only)
+     */
+    volatile uint8_t dropCnt;
+#if TKLSDLRCFG_EVT_ENA
+    /** \brief Scheduler instance of consuming task (`NULL` for default one) */
+    TKLsdlr_ctx_t* p_sdlr;
+    /** \brief Consuming task to release on commit (or \ref TKLQ_TSK_NONE) */
+    uint8_t relTsk;
+#endif /* TKLSDLRCFG_EVT_ENA */
+} TKLq_t;
+
+/**
+ * \brief Statically define message queue
+ *
+ * E.g.:
+ *
+ *     TKLQ_DEF(static, pv_adcQ, APP_adcSmpl_t, 8u);
+ *
+ * `sc_` is the storage class specifier of the definitions (may be empty).
+ * Defines the message slot array `<name_>Buf` (aligned for the message type
+ * `typ_`) and the queue `name_` referencing it.
+ */
+#if TKLSDLRCFG_EVT_ENA
+#define TKLQ_DEF(sc_, name_, typ_, slotCnt_) \
+    sc_ typ_ name_##Buf[slotCnt_]; \
+    sc_ TKLq_t name_ = {name_##Buf, sizeof(typ_), (slotCnt_), 0u, 0u, 0u, \
+                        NULL, TKLQ_TSK_NONE}
+#else
+#define TKLQ_DEF(sc_, name_, typ_, slotCnt_) \
+    sc_ typ_ name_##Buf[slotCnt_]; \
+    sc_ TKLq_t name_ = {name_##Buf, sizeof(typ_), (slotCnt_), 0u, 0u, 0u}
+#endif /* TKLSDLRCFG_EVT_ENA */
+
+/* OPERATIONS
+ * ==========
+ */
+
+/**
+ * \brief Reserve free message slot (producer)
+ *
+ * The message is written in place into the returned slot and then published
+ * via \ref TKLq_commit().  Reserving again before committing returns the same
+ * slot.
+ *
+ * \param me Message queue
+ *
+ * \return Free message slot, `NULL` if queue is full (message dropped)
+ */
+void* TKLq_reserve(TKLq_t* const me);
+
+/**
+ * \brief Publish message written into slot reserved previously (producer)
+ *
+ * Releases the consuming task, if set (see \ref TKLq_setRelTsk()).
+ *
+ * \param me Message queue
+ */
+void TKLq_commit(TKLq_t* const me);
+
+/**
+ * \brief Get oldest message in place (consumer)
+ *
+ * The message stays in the queue until freed via \ref TKLq_release().
+ *
+ * \param me Message queue
+ *
+ * \return Oldest message slot, `NULL` if queue is empty
+ */
+const void* TKLq_peek(TKLq_t* const me);
+
+/**
+ * \brief Free slot of oldest message, got previously (consumer)
+ *
+ * \param me Message queue
+ */
+void TKLq_release(TKLq_t* const me);
+
+/**
+ * \brief Get number of messages in queue
+ *
+ * \param me Message queue
+ *
+ * \return Number of committed messages not yet released
+ */
+uint8_t TKLq_cnt(const TKLq_t* const me);
+
+/**
+ * \brief Get number of messages dropped because queue was full
+ *
+ * \param me Message queue
+ *
+ * \return Number of dropped messages (saturates at `UINT8_MAX`)
+ */
+uint8_t TKLq_cntDrop(const TKLq_t* const me);
+
+#if TKLSDLRCFG_EVT_ENA
+/**
+ * \brief Set consuming task to release on each message commit
+ *
+ * An event is posted to the (sporadic) task on each \ref TKLq_commit(), so
+ * that it runs as soon as possible to consume the message(s).  The same
+ * restrictions as for \ref TKLsdlr_postEvt() apply to committing.  Must be
+ * set before the producer commits messages.
+ *
+ * \param me Message queue
+ * \param p_sdlr Scheduler instance the task list of which holds the task
+ * (`NULL` for default instance)
+ * \param tskIdx Index of sporadic task within task list, \ref TKLQ_TSK_NONE
+ * for none
+ */
+void TKLq_setRelTsk(TKLq_t* const me,
+                    TKLsdlr_ctx_t* const p_sdlr,
+                    const uint8_t tskIdx);
+#endif /* TKLSDLRCFG_EVT_ENA */
+
+#endif /* TKLQ_H */
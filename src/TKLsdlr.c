@@ -6,22 +6,1802 @@
  * ==========
  */
 
-/** \brief Pointer to function that provides curr. rel. sys. time tick */
-static TKLtyp_p_getTick_t pv_p_getTick;
+/**
+ * \brief Whether statically allocated per-task state is used (limits number
+ * of tasks within a task list to \ref TKLSDLRCFG_TSK_CNT_MAX)
+ */
+#define TSK_STATE_ENA (TKLSDLRCFG_PQ_ENA || \
+                       TKLSDLRCFG_STAT_ENA || \
+                       TKLSDLRCFG_TSK_OVERRUN_ENA || \
+                       TKLSDLRCFG_LOAD_ENA || \
+                       TKLSDLRCFG_ACT_MAP_ENA || \
+                       TKLSDLRCFG_REL_RECIP_ENA || \
+                       TKLSDLRCFG_DM_ORDER_ENA || \
+                       TKLSDLRCFG_OVLD_ENA)
+
+/**
+ * \brief Default scheduler instance
+ *
+ * Used by the free-function API (`TKLsdlr_<op>()`), i.e. all `TKLsdlr_<op>()`
+ * functions are wrappers of the respective `TKLsdlr_ctx<Op>()` functions on
+ * this instance.
+ */
+static TKLsdlr_ctx_t pv_ctx;
+
+#if TKLSDLRCFG_PQ_ENA
+/** \brief Marker for a task that is not within the release heap */
+#define PQ_NONE UINT8_MAX
+#endif /* TKLSDLRCFG_PQ_ENA */
+
+/** \brief De Bruijn sequence to find index of lowest set bit */
+#define DEBRUIJN_SEQ 0x077CB531u
+
+/** \brief Bit index lookup table for \ref DEBRUIJN_SEQ */
+static const uint8_t pv_deBruijnIdx[32] = {
+    0u, 1u, 28u, 2u, 29u, 14u, 24u, 3u, 30u, 22u, 20u, 15u, 25u, 17u, 4u, 8u,
+    31u, 27u, 13u, 23u, 21u, 19u, 16u, 7u, 26u, 12u, 18u, 6u, 11u, 5u, 10u, 9u
+};
+
+#if TKLSDLRCFG_TSK_OVERRUN_ENA
+#if 8 == TKLSDLRCFG_TSK_OVERRUN_CNT_WIDTH
+/** \brief Max. value of per-task deadline overrun counter */
+#define OVERRUN_CNT_MAX UINT8_MAX
+#elif 16 == TKLSDLRCFG_TSK_OVERRUN_CNT_WIDTH
+#define OVERRUN_CNT_MAX UINT16_MAX
+#else
+#define OVERRUN_CNT_MAX UINT32_MAX
+#endif /* TKLSDLRCFG_TSK_OVERRUN_CNT_WIDTH */
+#endif /* TKLSDLRCFG_TSK_OVERRUN_ENA */
+
+#if TKLSDLRCFG_LOAD_ENA
+/** \brief Length of CPU load measurement sub-window in time ticks */
+#define LOAD_SUBWIN_LEN (TKLSDLRCFG_LOAD_WIN / TKLSDLRCFG_LOAD_SUBWIN_CNT)
+
+/**
+ * \brief Number of CPU load sub-window buckets
+ *
+ * All complete sub-windows of the window plus the current (incomplete) one.
+ */
+#define LOAD_BUCKET_CNT (TKLSDLRCFG_LOAD_SUBWIN_CNT + 1u)
+
+/** \brief CPU load value for 100 % (result unit is 0.01 %) */
+#define LOAD_FULL 10000u
+#endif /* TKLSDLRCFG_LOAD_ENA */
 
-/** \brief Registered task list */
-static TKLtyp_tsk_t* volatile pv_p_tskLst;
+#if TKLSDLRCFG_REL_RECIP_ENA
+#if 16 == TKLSDLRCFG_TICK_WIDTH
+/**
+ * \brief Double width type for product of time tick count and reciprocal of
+ * period
+ */
+#define REL_RECIP_PROD_T uint32_t
+/** \brief Shift to get integer part of that product */
+#define REL_RECIP_SHIFT 16u
+#else
+#define REL_RECIP_PROD_T uint64_t
+#define REL_RECIP_SHIFT 32u
+#endif /* TKLSDLRCFG_TICK_WIDTH */
+#endif /* TKLSDLRCFG_REL_RECIP_ENA */
+
+#if TKLSDLRCFG_EVT_ENA
+/**
+ * \brief Bit of a task within event bitmaps
+ *
+ * MSB is task with index `0` (highest priority), so that counting the leading
+ * zeros of a bitmap yields the index of the highest priority task.
+ */
+#define EVT_BIT(tsk_) ((uint32_t)0x80000000u >> (tsk_))
+
+/** \brief Marker for no pending event */
+#define EVT_NONE UINT8_MAX
+#endif /* TKLSDLRCFG_EVT_ENA */
+
+#if TKLSDLRCFG_EDF_ENA && !TKLSDLRCFG_PQ_ENA
+/** \brief Marker for no due-to-run task */
+#define EDF_NONE UINT8_MAX
+#endif /* TKLSDLRCFG_EDF_ENA && !TKLSDLRCFG_PQ_ENA */
 
- /** \brief Number of tasks within registered task list */
-static volatile uint8_t pv_tskCnt;
+#if TKLSDLRCFG_CHAIN_ENA
+/** \brief Marker for no chain */
+#define CHAIN_NONE UINT8_MAX
+#endif /* TKLSDLRCFG_CHAIN_ENA */
 
- /** \brief Task deadline overrun counter */
-static volatile uint8_t pv_tskOverrunCnt;
+#if TKLSDLRCFG_ACT_MAP_ENA
+/**
+ * \brief Bit of a task within its word of the active task bitmap
+ *
+ * MSB is the task with the lowest index within the word (same as for event
+ * bitmaps), so that counting the leading zeros yields the next enabled task.
+ */
+#define ACT_BIT(tsk_) ((uint32_t)0x80000000u >> ((tsk_) % 32u))
+
+/** \brief Number of words of active task bitmap */
+#define ACT_MAP_WORD_CNT ((TKLSDLRCFG_TSK_CNT_MAX + 31u) / 32u)
+
+/** \brief Marker for no (further) enabled task */
+#define ACT_NONE UINT8_MAX
+
+/** \brief Most significant bit of time tick count (half of its range) */
+#define ACT_TICK_MSB ((TKLtyp_tick_t)(TKLTYP_TICK_MAX / 2u + 1u))
+#endif /* TKLSDLRCFG_ACT_MAP_ENA */
 
 /* OPERATIONS
  * ==========
  */
 
+#if TKLSDLRCFG_STAT_ENA
+/**
+ * \brief Record of one task run for execution statistics
+ *
+ * \param tskIdx Index of task within task list
+ * \param tickRel Ideal release time of task run
+ * \param tickStart Start time of task run
+ * \param tickEnd End time of task run
+ * \param execTs Execution time of task run in time stamp units (only with
+ * high-resolution time stamps)
+ */
+static void pv_statRec(TKLsdlr_ctx_t* const me,
+                       const uint8_t tskIdx,
+                       const TKLtyp_tick_t tickRel,
+                       const TKLtyp_tick_t tickStart,
+#if TKLSDLRCFG_TS_ENA
+                       const TKLtyp_tick_t tickEnd,
+                       const uint32_t execTs) {
+#else
+                       const TKLtyp_tick_t tickEnd) {
+#endif /* TKLSDLRCFG_TS_ENA */
+    TKLsdlr_statAcc_t* const p_stat = &me->tskStat[tskIdx];
+    const TKLtyp_tick_t execTime = tickEnd - tickStart;
+    const TKLtyp_tick_t respTime = tickEnd - tickRel;
+    const TKLtyp_tick_t startDly = tickStart - tickRel;
+
+    /* Min./max. values (keep being updated after run counter saturates) */
+    if (execTime < p_stat->execMin) {
+        p_stat->execMin = execTime;
+    }
+    if (execTime > p_stat->execMax) {
+        p_stat->execMax = execTime;
+    }
+    if (respTime < p_stat->respMin) {
+        p_stat->respMin = respTime;
+    }
+    if (respTime > p_stat->respMax) {
+        p_stat->respMax = respTime;
+    }
+    if (startDly < p_stat->startDlyMin) {
+        p_stat->startDlyMin = startDly;
+    }
+    if (startDly > p_stat->startDlyMax) {
+        p_stat->startDlyMax = startDly;
+    }
+#if TKLSDLRCFG_TS_ENA
+    if (execTs < p_stat->execTsMin) {
+        p_stat->execTsMin = execTs;
+    }
+    if (execTs > p_stat->execTsMax) {
+        p_stat->execTsMax = execTs;
+    }
+#endif /* TKLSDLRCFG_TS_ENA */
+
+    /* Sums for mean values (frozen once run counter saturates, so that mean
+       values remain consistent) */
+    if (UINT32_MAX > p_stat->runCnt) { /* Counter unsaturated? */
+        p_stat->runCnt++;
+        p_stat->execSum += execTime;
+        p_stat->respSum += respTime;
+#if TKLSDLRCFG_TS_ENA
+        p_stat->execTsSum += execTs;
+#endif /* TKLSDLRCFG_TS_ENA */
+    }
+}
+
+/**
+ * \brief Reset execution statistics of all tasks
+ *
+ * Min. values start at max. so that the first task run sets them.
+ */
+static void pv_statClr(TKLsdlr_ctx_t* const me) {
+    for (uint8_t i = 0u; TKLSDLRCFG_TSK_CNT_MAX > i; i++) {
+        me->tskStat[i] = (TKLsdlr_statAcc_t){.execMin = TKLTYP_TICK_MAX,
+                                             .respMin = TKLTYP_TICK_MAX,
+#if TKLSDLRCFG_TS_ENA
+                                             .execTsMin = UINT32_MAX,
+#endif /* TKLSDLRCFG_TS_ENA */
+                                             .startDlyMin = TKLTYP_TICK_MAX};
+    }
+}
+#endif /* TKLSDLRCFG_STAT_ENA */
+
+#if TKLSDLRCFG_TSK_OVERRUN_ENA
+/**
+ * \brief Record deadline overrun of a task
+ *
+ * \param tskIdx Index of task within task list
+ * \param tickEnd End time of task run
+ * \param lateness Time by which task finished late
+ * \param execTs Execution time of task run in time stamp units (only with
+ * high-resolution time stamps)
+ */
+static void pv_tskOverrunRec(TKLsdlr_ctx_t* const me,
+                             const uint8_t tskIdx,
+                             const TKLtyp_tick_t tickEnd,
+#if TKLSDLRCFG_TS_ENA
+                             const TKLtyp_tick_t lateness,
+                             const uint32_t execTs) {
+#else
+                             const TKLtyp_tick_t lateness) {
+#endif /* TKLSDLRCFG_TS_ENA */
+    if (OVERRUN_CNT_MAX > me->tskOverrunCntPerTsk[tskIdx]) { /* Unsaturated? */
+        me->tskOverrunCntPerTsk[tskIdx]++;
+    }
+    me->tskOverrunLastTick[tskIdx] = tickEnd;
+    if (lateness > me->tskOverrunWorstLateness[tskIdx]) {
+        me->tskOverrunWorstLateness[tskIdx] = lateness;
+    }
+#if TKLSDLRCFG_TS_ENA
+    me->tskOverrunLastExecTs[tskIdx] = execTs;
+#endif /* TKLSDLRCFG_TS_ENA */
+    me->lastOverrunTsk = tskIdx;
+}
+
+/** \brief Reset deadline overrun records of all tasks */
+static void pv_tskOverrunClr(TKLsdlr_ctx_t* const me) {
+    for (uint8_t i = 0u; TKLSDLRCFG_TSK_CNT_MAX > i; i++) {
+        me->tskOverrunCntPerTsk[i] = 0u;
+        me->tskOverrunLastTick[i] = 0u;
+        me->tskOverrunWorstLateness[i] = 0u;
+#if TKLSDLRCFG_TS_ENA
+        me->tskOverrunLastExecTs[i] = 0u;
+#endif /* TKLSDLRCFG_TS_ENA */
+    }
+    me->lastOverrunTsk = 0u;
+}
+#endif /* TKLSDLRCFG_TSK_OVERRUN_ENA */
+
+#if TKLSDLRCFG_TRACE_ENA
+/**
+ * \brief Record trace event
+ *
+ * Drops event if trace ring buffer is full.
+ *
+ * \param evtTyp Event type (`TKLTYP_TRACE_...`)
+ * \param tskIdx Index of task within task list
+ * \param tick Time stamp
+ */
+static void pv_trace(TKLsdlr_ctx_t* const me,
+                     const uint8_t evtTyp,
+                     const uint8_t tskIdx,
+                     const TKLtyp_tick_t tick) {
+    const uint8_t head = me->traceHead;
+
+    /* Free slot? */
+    if (TKLSDLRCFG_TRACE_BUF_LEN > (uint8_t)(head - me->traceTail)) {
+        TKLSDLR_BARRIER(); /* Check for free slot before writing it */
+        me->traceBuf[head & (TKLSDLRCFG_TRACE_BUF_LEN - 1u)] =
+            (TKLtyp_traceEvt_t){.tick = tick, .tskIdx = tskIdx, .typ = evtTyp};
+        TKLSDLR_BARRIER();
+        me->traceHead = (uint8_t)(head + 1u); /* Publish event after writing */
+    } else if (UINT8_MAX > me->traceDropCnt) { /* Counter unsaturated? */
+        me->traceDropCnt++;
+    } else {
+        /* Do nothing (drop counter saturated) */
+    }
+}
+#endif /* TKLSDLRCFG_TRACE_ENA */
+
+#if TKLSDLRCFG_LOAD_ENA
+/**
+ * \brief Clear busy time of a CPU load sub-window bucket
+ *
+ * \param bucket Bucket to clear
+ */
+static void pv_loadClrBucket(TKLsdlr_ctx_t* const me, const uint8_t bucket) {
+    me->loadBusy[bucket] = 0u;
+    for (uint8_t i = 0u; TKLSDLRCFG_TSK_CNT_MAX > i; i++) {
+        me->loadTskBusy[i][bucket] = 0u;
+    }
+}
+
+/**
+ * \brief Slide CPU load measurement window up to current time
+ *
+ * Costs one comparison if the current sub-window has not elapsed yet.
+ *
+ * \param tickCnt Current relative system time tick count
+ */
+static void pv_loadAdv(TKLsdlr_ctx_t* const me, const TKLtyp_tick_t tickCnt) {
+    if (UINT8_MAX == me->loadSubWinCnt) { /* (Re-)start of measurement? */
+        for (uint8_t i = 0u; LOAD_BUCKET_CNT > i; i++) {
+            pv_loadClrBucket(me, i);
+        }
+        me->loadSubWinStart = tickCnt;
+        me->loadSubWinCnt = 0u;
+    }
+
+    /* Complete elapsed sub-windows (still correct on tick count rollover).
+       After more than a whole window, all buckets are cleared, so only the
+       phase of the sub-windows needs to be re-aligned. */
+    for (uint8_t i = 0u;
+         (TKLtyp_tick_t)(tickCnt - me->loadSubWinStart) >= LOAD_SUBWIN_LEN;
+         i++) {
+        if (LOAD_BUCKET_CNT > i) {
+            me->loadSubWinStart += LOAD_SUBWIN_LEN;
+            me->loadBucket =
+                (uint8_t)((me->loadBucket + 1u) % LOAD_BUCKET_CNT);
+            pv_loadClrBucket(me, me->loadBucket);
+            if (TKLSDLRCFG_LOAD_SUBWIN_CNT > me->loadSubWinCnt) {
+                me->loadSubWinCnt++;
+            }
+        } else {
+            me->loadSubWinStart = tickCnt;
+        }
+    } /* for (...) */
+}
+
+/**
+ * \brief Calc. CPU load from busy time per sub-window bucket over all complete
+ * sub-windows
+ *
+ * \param p_busy Busy time per sub-window bucket
+ *
+ * \return CPU load in 0.01 % (`0` if no sub-window is complete yet)
+ */
+static uint16_t pv_loadCalc(TKLsdlr_ctx_t* const me,
+                            const TKLtyp_tick_t* const p_busy) {
+    uint64_t busy = 0u;
+    uint16_t load = 0u;
+
+    for (uint8_t i = 0u; LOAD_BUCKET_CNT > i; i++) {
+        if (me->loadBucket != i) { /* Complete sub-window? */
+            busy += p_busy[i];
+        }
+    }
+
+    if (0u < me->loadSubWinCnt) {
+        busy = (busy * LOAD_FULL) /
+               ((uint64_t)me->loadSubWinCnt * LOAD_SUBWIN_LEN);
+        load = (uint16_t)((LOAD_FULL < busy) ? LOAD_FULL : busy);
+    }
+
+    return (load);
+}
+#endif /* TKLSDLRCFG_LOAD_ENA */
+
+#if TKLSDLRCFG_EVT_ENA || TKLSDLRCFG_ACT_MAP_ENA
+/**
+ * \brief Count leading zeros of a bit mask
+ *
+ * Uses the compiler built-in (typically a single instruction) if available.
+ *
+ * \param mask Bit mask (must not be `0`)
+ *
+ * \return Number of leading zeros
+ */
+static uint8_t pv_cntLeadZero(uint32_t mask) {
+#if defined(__GNUC__)
+    /* `unsigned long` has at least 32 bit, so skip its excess upper bits */
+    const unsigned int excess = (unsigned int)((sizeof(unsigned long) * 8u) -
+                                               32u);
+
+    return ((uint8_t)((unsigned int)__builtin_clzl((unsigned long)mask) -
+                      excess));
+#else
+    uint8_t cnt = 0u;
+
+    /* Binary search for most significant set bit */
+    for (uint8_t width = 16u; 0u < width; width /= 2u) {
+        if (0u == (mask >> (32u - width))) {
+            cnt += width;
+            mask <<= width;
+        }
+    }
+
+    return (cnt);
+#endif /* defined(__GNUC__) */
+}
+#endif /* TKLSDLRCFG_EVT_ENA || TKLSDLRCFG_ACT_MAP_ENA */
+
+/**
+ * \brief Find index of lowest set bit in constant time
+ *
+ * \param mask Bit mask (must not be `0`)
+ *
+ * \return Index of lowest set bit
+ */
+static uint8_t pv_findFirstSet(const uint32_t mask) {
+    /* Isolate lowest set bit and map it via De Bruijn sequence */
+    return (pv_deBruijnIdx[((mask & (0u - mask)) * DEBRUIJN_SEQ) >> 27u]);
+}
+
+/**
+ * \brief Get (ideal) release time of a due-to-run task of registered task
+ * list (see \ref TKLsdlr_calcRel())
+ *
+ * \param tskIdx Index of task within task list (must be due to run)
+ * \param tickCnt Relative system time tick count
+ *
+ * \return Release time
+ */
+static TKLtyp_tick_t pv_calcRel(const TKLsdlr_ctx_t* const me,
+                                const uint8_t tskIdx,
+                                const TKLtyp_tick_t tickCnt) {
+    const TKLsdlr_tskLst_t* const p_tskLst = me->p_tskLst;
+
+    return (TKLsdlr_calcRel(TKLSDLR_TSK_PERIOD(p_tskLst, tskIdx),
+                            TKLSDLR_TSK_LAST_RUN(p_tskLst, tskIdx),
+                            tickCnt,
+#if TKLSDLRCFG_REL_RECIP_ENA
+                            me->relRecip[tskIdx]));
+#else
+                            0u));
+#endif /* TKLSDLRCFG_REL_RECIP_ENA */
+}
+
+#if TKLSDLRCFG_REL_RECIP_ENA
+/**
+ * \brief Precompute reciprocals of task periods for release time calculation
+ *
+ * \param tskCnt Number of tasks within registered task list
+ */
+static void pv_relInit(TKLsdlr_ctx_t* const me, const uint8_t tskCnt) {
+    for (uint8_t i = 0u; tskCnt > i; i++) {
+        me->relRecip[i] =
+            TKLsdlr_calcRelRecip(TKLSDLR_TSK_PERIOD(me->p_tskLst, i));
+    }
+}
+#endif /* TKLSDLRCFG_REL_RECIP_ENA */
+
+#if TKLSDLRCFG_ACT_MAP_ENA
+/**
+ * \brief Record how far the task list scan of an execution cycle reached
+ *
+ * The stack of records is kept minimal:  A record supersedes all older ones
+ * that reached no further, so records from bottom to top are ever more recent
+ * and reach ever fewer tasks (at most one record per task).
+ *
+ * \param tskIdx Index of last task within task list that was reached
+ * \param tickCnt Relative system time tick count at start of scheduling
+ * algorithm execution cycle
+ */
+static void pv_actReach(TKLsdlr_ctx_t* const me,
+                        const uint8_t tskIdx,
+                        const TKLtyp_tick_t tickCnt) {
+    while ((0u < me->actReachCnt) &&
+           (tskIdx >= me->actReachIdx[me->actReachCnt - 1u])) {
+        me->actReachCnt--; /* Drop superseded record */
+    }
+
+    me->actReachIdx[me->actReachCnt] = tskIdx;
+    me->actReachTick[me->actReachCnt] = tickCnt;
+    me->actReachCnt++;
+}
+
+/**
+ * \brief Catch up on the `lastRun` time updates a disabled task skipped
+ *
+ * The task list scan without active task bitmap updates `lastRun` of a
+ * disabled task whenever it reaches the task while it is due, always to the
+ * latest ideal release time.  Since realigning an up-to-date `lastRun` time
+ * has no effect, applying this once for the most recent execution cycle that
+ * reached the task yields the very same `lastRun` time.  Records older than
+ * the task's `lastRun` time itself (e.g., set on deactivation) are void.
+ *
+ * \param tskIdx Index of (disabled) task within task list
+ * \param tickCnt Current relative system time tick count
+ */
+static void pv_actUpdLastRun(TKLsdlr_ctx_t* const me,
+                             const uint8_t tskIdx,
+                             const TKLtyp_tick_t tickCnt) {
+    TKLsdlr_tskLst_t* const p_tskLst = me->p_tskLst;
+    uint8_t pos = me->actReachCnt;
+
+    /* Find most recent execution cycle that reached task */
+    while ((0u < pos) && (tskIdx > me->actReachIdx[pos - 1u])) {
+        pos--;
+    }
+
+    const TKLtyp_tick_t period = TKLSDLR_TSK_PERIOD(p_tskLst, tskIdx);
+
+    if ((0u < pos) && (0u < period)) { /* Reached periodic task? */
+        const TKLtyp_tick_t tickReach = me->actReachTick[pos - 1u];
+        const TKLtyp_tick_t lastRun = TKLSDLR_TSK_LAST_RUN(p_tskLst, tskIdx);
+
+        /* Not older than `lastRun` and due to run back then (still correct
+           on tick count rollover)? */
+        if (((TKLtyp_tick_t)(tickCnt - tickReach) <=
+             (TKLtyp_tick_t)(tickCnt - lastRun)) &&
+            ((TKLtyp_tick_t)(tickReach - lastRun) >= period)) {
+            /* Save (ideal) time of when task was "ready-to-run" */
+            TKLSDLR_TSK_LAST_RUN(p_tskLst, tskIdx) =
+                pv_calcRel(me, tskIdx, tickReach);
+        }
+    }
+}
+
+/**
+ * \brief Bring `lastRun` times of all disabled tasks up to date and drop all
+ * task list scan records
+ *
+ * Needed once per half the time tick count range, so that no `lastRun` time
+ * falls behind by more than the tick count range can represent.
+ *
+ * \param tickCnt Current relative system time tick count
+ */
+static void pv_actSync(TKLsdlr_ctx_t* const me, const TKLtyp_tick_t tickCnt) {
+    for (uint8_t i = 0u; me->tskCnt > i; i++) {
+        if (0u == (me->actMap[i / 32u] & ACT_BIT(i))) { /* Task disabled? */
+            pv_actUpdLastRun(me, i, tickCnt);
+        }
+    }
+
+    me->actReachCnt = 0u;
+}
+
+/**
+ * \brief Find next enabled task (or sporadic task with pending event) within
+ * task list
+ *
+ * \param tskIdx Index of task within task list to start search at
+ *
+ * \return Index of task within task list, \ref ACT_NONE if there is none
+ */
+static uint8_t pv_actNext(const TKLsdlr_ctx_t* const me, const uint8_t tskIdx) {
+    uint8_t next = ACT_NONE;
+
+    for (uint8_t w = tskIdx / 32u;
+         (ACT_NONE == next) && (ACT_MAP_WORD_CNT > w);
+         w++) {
+        uint32_t mask = me->actMap[w];
+
+#if TKLSDLRCFG_EVT_ENA
+        if (0u == w) { /* Word of sporadic tasks? */
+            mask |= me->evtPost ^ me->evtAck; /* Events of disabled tasks */
+        }
+#endif /* TKLSDLRCFG_EVT_ENA */
+        if ((tskIdx / 32u) == w) { /* Word of start task? */
+            mask &= UINT32_MAX >> (tskIdx % 32u); /* Skip preceding tasks */
+        }
+
+        if (0u != mask) {
+            next = (uint8_t)((w * 32u) + pv_cntLeadZero(mask));
+        }
+    }
+
+    return (next);
+}
+
+/**
+ * \brief Build active task bitmap from registered task list
+ *
+ * \param tskCnt Number of tasks within registered task list
+ */
+static void pv_actInit(TKLsdlr_ctx_t* const me, const uint8_t tskCnt) {
+    (void)memset(me->actMap, 0, sizeof(me->actMap));
+    for (uint8_t i = 0u; tskCnt > i; i++) {
+        if (true == TKLSDLR_TSK_ACTIVE(me->p_tskLst, i)) { /* Task enabled? */
+            me->actMap[i / 32u] |= ACT_BIT(i);
+        }
+    }
+
+    me->actReachCnt = 0u;
+}
+#endif /* TKLSDLRCFG_ACT_MAP_ENA */
+
+#if TKLSDLRCFG_DM_ORDER_ENA
+/**
+ * \brief Build deadline-monotonic dispatch order of registered task list
+ *
+ * Stable insertion sort by deadline, so that tasks with equal deadlines keep
+ * their order within task list.
+ *
+ * \param tskCnt Number of tasks within registered task list
+ */
+static void pv_dispInit(TKLsdlr_ctx_t* const me, const uint8_t tskCnt) {
+    const TKLsdlr_tskLst_t* const p_tskLst = me->p_tskLst;
+
+    for (uint8_t i = 0u; tskCnt > i; i++) {
+        const TKLtyp_tick_t deadline = TKLSDLR_TSK_DEADLINE(p_tskLst, i);
+        uint8_t pos = i;
+
+        while ((0u < pos) &&
+               (TKLSDLR_TSK_DEADLINE(p_tskLst, me->dispOrder[pos - 1u]) >
+                deadline)) {
+            me->dispOrder[pos] = me->dispOrder[pos - 1u];
+            pos--;
+        }
+        me->dispOrder[pos] = i;
+    }
+
+    me->dispMisorderCnt = 0u;
+    for (uint8_t prio = 0u; tskCnt > prio; prio++) {
+        me->dispPrio[me->dispOrder[prio]] = prio;
+        if (prio != me->dispOrder[prio]) { /* Out of task list order? */
+            me->dispMisorderCnt++;
+        }
+    }
+}
+#endif /* TKLSDLRCFG_DM_ORDER_ENA */
+
+#if TKLSDLRCFG_OVLD_ENA
+/**
+ * \brief Reset overload management for a newly registered task list
+ *
+ * \param tskCnt Number of tasks within registered task list
+ */
+static void pv_ovldInit(TKLsdlr_ctx_t* const me, const uint8_t tskCnt) {
+    for (uint8_t i = 0u; tskCnt > i; i++) {
+        me->ovldCrit[i] = 0u;
+#if 0u < TKLSDLRCFG_OVLD_STRETCH
+        me->ovldSkipCnt[i] = 0u;
+#endif /* 0u < TKLSDLRCFG_OVLD_STRETCH */
+    }
+    me->ovldCritMax = 0u;
+    me->ovldLvl = 0u;
+    me->ovldOverrunCnt = 0u;
+}
+
+/**
+ * \brief Close overload detection window once elapsed
+ *
+ * Lowers overload level after a window without any deadline overrun.
+ *
+ * \param tickCnt Current relative system time tick count
+ */
+static void pv_ovldAdv(TKLsdlr_ctx_t* const me, const TKLtyp_tick_t tickCnt) {
+    /* Window elapsed (still correct on tick count rollover)? */
+    if ((TKLtyp_tick_t)(tickCnt - me->ovldWinStart) >= TKLSDLRCFG_OVLD_WIN) {
+        if ((0u == me->ovldOverrunCnt) && (0u < me->ovldLvl)) { /* Recovered? */
+            me->ovldLvl--;
+        }
+        me->ovldOverrunCnt = 0u;
+        me->ovldWinStart = tickCnt;
+    }
+}
+
+/**
+ * \brief Count a deadline overrun and raise overload level if too many
+ * happened within current window
+ *
+ * \param tickCnt Relative system time tick count at end of overrunning task
+ * run
+ */
+static void pv_ovldOverrun(TKLsdlr_ctx_t* const me,
+                           const TKLtyp_tick_t tickCnt) {
+    me->ovldOverrunCnt++;
+    if (TKLSDLRCFG_OVLD_OVERRUN_MAX <= me->ovldOverrunCnt) { /* Overload? */
+        /* Highest criticality is never shed */
+        if (me->ovldCritMax > me->ovldLvl) {
+            me->ovldLvl++;
+        }
+
+        /* Give new overload level a full window */
+        me->ovldOverrunCnt = 0u;
+        me->ovldWinStart = tickCnt;
+    }
+}
+#endif /* TKLSDLRCFG_OVLD_ENA */
+
+/**
+ * \brief Check whether a released task is to be run
+ *
+ * Must only be called once per release that is consumed if the task is not
+ * to be run.
+ *
+ * \param tskIdx Index of task within task list
+ *
+ * \return `true` if task is enabled (and, with overload management, not
+ * shed)
+ */
+static bool pv_isTskRunnable(TKLsdlr_ctx_t* const me, const uint8_t tskIdx) {
+    bool isRunnable = TKLSDLR_TSK_ACTIVE(me->p_tskLst, tskIdx);
+
+#if TKLSDLRCFG_OVLD_ENA
+    /* Task shed (criticality below overload level)? */
+    if ((true == isRunnable) && (me->ovldCrit[tskIdx] < me->ovldLvl)) {
+#if 0u < TKLSDLRCFG_OVLD_STRETCH
+        if (0u < me->ovldSkipCnt[tskIdx]) { /* Release to skip? */
+            me->ovldSkipCnt[tskIdx]--;
+            isRunnable = false;
+        }
+#else
+        isRunnable = false;
+#endif /* 0u < TKLSDLRCFG_OVLD_STRETCH */
+    }
+#else
+    (void)me;
+#endif /* TKLSDLRCFG_OVLD_ENA */
+
+    return (isRunnable);
+}
+
+/**
+ * \brief Run a due-to-run task and check it for deadline overrun
+ *
+ * \param tskIdx Index of task to run within task list (with `lastRun` already
+ * set to ideal time of when task was "ready-to-run")
+ * \param tickStart Relative system time tick count at start of scheduling
+ * algorithm execution cycle (i.e., start of task run)
+ */
+static void pv_runTsk(TKLsdlr_ctx_t* const me,
+                      const uint8_t tskIdx,
+                      const TKLtyp_tick_t tickStart) {
+    const TKLsdlr_tskLst_t* const p_tskLst = me->p_tskLst;
+#if TKLSDLRCFG_STAT_ENA || TKLSDLRCFG_TRACE_ENA || TKLSDLRCFG_CHAIN_ENA
+    /* Task runner might change it */
+    const TKLtyp_tick_t tickRel = TKLSDLR_TSK_LAST_RUN(p_tskLst, tskIdx);
+#endif /* TKLSDLRCFG_STAT_ENA || TKLSDLRCFG_TRACE_ENA || ... */
+#if !TKLSDLRCFG_STAT_ENA && !TKLSDLRCFG_TRACE_ENA && \
+    !TKLSDLRCFG_LOAD_ENA && !TKLSDLRCFG_ACT_MAP_ENA
+    (void)tickStart; /* Unused without statistics, trace, CPU load and active
+                        task bitmap */
+#endif /* !TKLSDLRCFG_STAT_ENA && ... */
+
+#if TKLSDLRCFG_ACT_MAP_ENA
+    /* Record before run, since task runner might re-enable skipped tasks */
+    pv_actReach(me, tskIdx, tickStart);
+#endif /* TKLSDLRCFG_ACT_MAP_ENA */
+
+#if TKLSDLRCFG_TRACE_ENA
+    pv_trace(me, TKLTYP_TRACE_REL, tskIdx, tickRel);
+    pv_trace(me, TKLTYP_TRACE_START, tskIdx, tickStart);
+#endif /* TKLSDLRCFG_TRACE_ENA */
+
+#if TKLSDLRCFG_TS_ENA
+    const TKLtyp_p_getTs_t p_getTs = me->p_getTs;
+    const uint32_t tsStart = (NULL != p_getTs) ? (*p_getTs)() : 0u;
+#endif /* TKLSDLRCFG_TS_ENA */
+
+    (*TKLSDLR_TSK_RUNNER(p_tskLst, tskIdx))(); /* Run periodic task */
+
+#if TKLSDLRCFG_TS_ENA
+    /* Still correct on time stamp rollover */
+    const uint32_t execTs = (NULL != p_getTs) ? ((*p_getTs)() - tsStart) : 0u;
+#endif /* TKLSDLRCFG_TS_ENA */
+    const TKLtyp_tick_t tickEnd = (*me->p_getTick)();
+
+#if TKLSDLRCFG_TRACE_ENA
+    pv_trace(me, TKLTYP_TRACE_END, tskIdx, tickEnd);
+#endif /* TKLSDLRCFG_TRACE_ENA */
+
+    const TKLtyp_tick_t tickResp =
+        tickEnd - TKLSDLR_TSK_LAST_RUN(p_tskLst, tskIdx);
+    const TKLtyp_tick_t deadline = TKLSDLR_TSK_DEADLINE(p_tskLst, tskIdx);
+
+    /* Check for task deadline overrun (still correct on time tick rollover) */
+    if (tickResp > deadline) {
+        if (UINT8_MAX > me->tskOverrunCnt) { /* Counter unsaturated? */
+            me->tskOverrunCnt++; /* Incr. deadline overrun counter */
+        }
+
+#if TKLSDLRCFG_TSK_OVERRUN_ENA
+#if TKLSDLRCFG_TS_ENA
+        pv_tskOverrunRec(me, tskIdx, tickEnd, tickResp - deadline, execTs);
+#else
+        pv_tskOverrunRec(me, tskIdx, tickEnd, tickResp - deadline);
+#endif /* TKLSDLRCFG_TS_ENA */
+#endif /* TKLSDLRCFG_TSK_OVERRUN_ENA */
+#if TKLSDLRCFG_TRACE_ENA
+        pv_trace(me, TKLTYP_TRACE_OVERRUN, tskIdx, tickEnd);
+#endif /* TKLSDLRCFG_TRACE_ENA */
+
+        /* Run custom deadline overrun hook, if defined */
+        TKLSDLRCFG_OVERRUN_HOOK(TKLSDLR_TSK_RUNNER(p_tskLst, tskIdx));
+#if TKLSDLRCFG_OVLD_ENA
+        pv_ovldOverrun(me, tickEnd);
+#endif /* TKLSDLRCFG_OVLD_ENA */
+    }
+#if TKLSDLRCFG_OVLD_ENA && (0u < TKLSDLRCFG_OVLD_STRETCH)
+    /* Releases to skip until next run, in case task is shed */
+    me->ovldSkipCnt[tskIdx] = (uint8_t)(TKLSDLRCFG_OVLD_STRETCH - 1u);
+#endif /* TKLSDLRCFG_OVLD_ENA && ... */
+
+#if TKLSDLRCFG_STAT_ENA
+#if TKLSDLRCFG_TS_ENA
+    pv_statRec(me, tskIdx, tickRel, tickStart, tickEnd, execTs);
+#else
+    pv_statRec(me, tskIdx, tickRel, tickStart, tickEnd);
+#endif /* TKLSDLRCFG_TS_ENA */
+#endif /* TKLSDLRCFG_STAT_ENA */
+#if TKLSDLRCFG_LOAD_ENA
+    /* Account busy time to sub-window of task start */
+    const TKLtyp_tick_t tickBusy = tickEnd - tickStart;
+
+    me->loadBusy[me->loadBucket] += tickBusy;
+    me->loadTskBusy[tskIdx][me->loadBucket] += tickBusy;
+#endif /* TKLSDLRCFG_LOAD_ENA */
+#if TKLSDLRCFG_CHAIN_ENA
+    me->chainTickEnd = tickEnd; /* Consumers start right after */
+    if ((NULL != me->p_chainTbl) &&
+        (CHAIN_NONE != me->chainOfHead[tskIdx])) { /* Head of chain? */
+        me->chainCur = me->chainOfHead[tskIdx];
+        me->chainRel = tickRel;
+    }
+#endif /* TKLSDLRCFG_CHAIN_ENA */
+}
+
+#if TKLSDLRCFG_CHAIN_ENA
+/**
+ * \brief Run consumers of chain whose head task was just run, back-to-back,
+ * and check chain for end-to-end deadline overrun
+ */
+static void pv_chainExec(TKLsdlr_ctx_t* const me) {
+    TKLsdlr_tskLst_t* const p_tskLst = me->p_tskLst; /* Set ptr. to task list */
+    const TKLtyp_chainTbl_t* const p_chainTbl = me->p_chainTbl;
+    const uint8_t chain = me->chainCur;
+    uint8_t finTsk = p_chainTbl->p_chain[chain].headTsk; /* Finished task */
+    uint32_t finMask = 0u; /* Finished tasks */
+    uint32_t rdyMask = 0u; /* Released tasks */
+    bool isFin = true;
+
+    me->chainCur = CHAIN_NONE;
+
+    while (true == isFin) {
+        uint32_t consMask = p_chainTbl->p_cons[finTsk];
+
+        finMask |= (uint32_t)1u << finTsk;
+
+        /* Release consumers all producers of which have finished */
+        while (0u != consMask) {
+            const uint8_t tsk = pv_findFirstSet(consMask);
+
+            consMask &= consMask - 1u; /* Clear lowest set bit */
+            if (0u == (me->chainProdMask[tsk] & ~finMask)) {
+                rdyMask |= (uint32_t)1u << tsk;
+            }
+        }
+
+        /* Run released consumers in task list order (priority) */
+        isFin = (0u != rdyMask);
+        if (true == isFin) {
+            finTsk = pv_findFirstSet(rdyMask);
+            rdyMask &= rdyMask - 1u; /* Clear lowest set bit */
+
+            /* Released at end of run of its last producer */
+            TKLSDLR_TSK_LAST_RUN(p_tskLst, finTsk) = me->chainTickEnd;
+            if (true == pv_isTskRunnable(me, finTsk)) { /* Task enabled? */
+                pv_runTsk(me, finTsk, me->chainTickEnd);
+            }
+        }
+    } /* while (...) */
+
+    /* Check for end-to-end deadline overrun (still correct on time tick
+       rollover) */
+    const TKLtyp_tick_t tickLat = (TKLtyp_tick_t)(me->chainTickEnd -
+                                                  me->chainRel);
+
+    if (tickLat > me->chainLatMax[chain]) {
+        me->chainLatMax[chain] = tickLat;
+    }
+    if ((tickLat > p_chainTbl->p_chain[chain].deadline) &&
+        (UINT8_MAX > me->chainOverrunCnt)) { /* Counter unsaturated? */
+        me->chainOverrunCnt++;
+    }
+}
+#endif /* TKLSDLRCFG_CHAIN_ENA */
+
+#if TKLSDLRCFG_EVT_ENA
+/**
+ * \brief Get highest priority sporadic task with pending event
+ *
+ * Priority is task list order or, with deadline-monotonic dispatch order,
+ * position within dispatch order.
+ *
+ * \return Index of task within task list, \ref EVT_NONE if no event is
+ * pending
+ */
+static uint8_t pv_evtPeek(const TKLsdlr_ctx_t* const me) {
+#if TKLSDLRCFG_DM_ORDER_ENA
+    uint32_t evtRdyMask = me->evtPost ^ me->evtAck;
+    uint8_t evtTsk = EVT_NONE;
+
+    /* Highest priority within dispatch order */
+    while (0u != evtRdyMask) {
+        const uint8_t tsk = pv_cntLeadZero(evtRdyMask);
+
+        evtRdyMask &= ~EVT_BIT(tsk);
+        if ((EVT_NONE == evtTsk) ||
+            (me->dispPrio[evtTsk] > me->dispPrio[tsk])) {
+            evtTsk = tsk;
+        }
+    }
+
+    return (evtTsk);
+#else
+    const uint32_t evtRdyMask = me->evtPost ^ me->evtAck;
+
+    return ((0u == evtRdyMask) ? EVT_NONE : pv_cntLeadZero(evtRdyMask));
+#endif /* TKLSDLRCFG_DM_ORDER_ENA */
+}
+
+/**
+ * \brief Release a sporadic task with pending event
+ *
+ * Consumes the event before the task is run, so that an event posted during
+ * the task run is not lost.  The release time (`lastRun`) is the start of the
+ * scheduling algorithm execution cycle that handles the event.  Disabled tasks
+ * are not run (event is dropped).
+ *
+ * \param tsk Index of task within task list
+ * \param tickCnt Relative system time tick count at start of scheduling
+ * algorithm execution cycle
+ *
+ * \return `true` if task was run
+ */
+static bool pv_evtRel(TKLsdlr_ctx_t* const me,
+                      const uint8_t tsk,
+                      const TKLtyp_tick_t tickCnt) {
+    TKLsdlr_tskLst_t* const p_tskLst = me->p_tskLst;
+    bool isTskRun = false;
+
+    me->evtAck ^= EVT_BIT(tsk); /* Only written here, i.e. no race with ISR */
+    TKLSDLR_TSK_LAST_RUN(p_tskLst, tsk) = tickCnt;
+
+    if (true == pv_isTskRunnable(me, tsk)) { /* Task enabled? */
+        pv_runTsk(me, tsk, tickCnt);
+        isTskRun = true;
+    }
+
+    return (isTskRun);
+}
+#endif /* TKLSDLRCFG_EVT_ENA */
+
+#if TKLSDLRCFG_EDF_ENA
+/**
+ * \brief Get absolute deadline of the pending release of a due-to-run
+ * periodic task
+ *
+ * With lost periods, this is the deadline of the earliest missed release
+ * (i.e., the task is already late).
+ *
+ * \param tsk Index of task within task list
+ *
+ * \return Absolute deadline
+ */
+static TKLtyp_tick_t pv_edfDl(const TKLsdlr_ctx_t* const me,
+                              const uint8_t tsk) {
+    const TKLsdlr_tskLst_t* const p_tskLst = me->p_tskLst;
+
+    return ((TKLtyp_tick_t)(TKLSDLR_TSK_LAST_RUN(p_tskLst, tsk) +
+                            TKLSDLR_TSK_PERIOD(p_tskLst, tsk) +
+                            TKLSDLR_TSK_DEADLINE(p_tskLst, tsk)));
+}
+
+/**
+ * \brief Check if a task has an earlier absolute deadline than another one
+ *
+ * Still correct on tick count rollover, as long as both deadlines are less
+ * than half the tick count range apart.  Ties are broken by task list order.
+ *
+ * \param dlA Absolute deadline of task `tskA`
+ * \param tskA Task index
+ * \param dlB Absolute deadline of task `tskB`
+ * \param tskB Task index
+ *
+ * \return `true` if task `tskA` is to be run before task `tskB`
+ */
+static bool pv_edfIsBefore(const TKLtyp_tick_t dlA,
+                           const uint8_t tskA,
+                           const TKLtyp_tick_t dlB,
+                           const uint8_t tskB) {
+    const TKLtyp_tick_t delta = dlB - dlA;
+
+    return ((0u != delta) ? ((TKLTYP_TICK_MAX / 2u) >= delta) : (tskA < tskB));
+}
+
+#if TKLSDLRCFG_EVT_ENA
+/**
+ * \brief Get sporadic task with pending event and earliest absolute deadline
+ *
+ * Events of disabled tasks are dropped on the way (see \ref pv_evtRel()).
+ *
+ * \param tickCnt Relative system time tick count at start of scheduling
+ * algorithm execution cycle
+ * \param p_dl Receives absolute deadline of task (if any)
+ *
+ * \return Index of task within task list, \ref EVT_NONE if no event of an
+ * enabled task is pending
+ */
+static uint8_t pv_edfEvtPeek(TKLsdlr_ctx_t* const me,
+                             const TKLtyp_tick_t tickCnt,
+                             TKLtyp_tick_t* const p_dl) {
+    const TKLsdlr_tskLst_t* const p_tskLst = me->p_tskLst;
+    uint32_t evtRdyMask = me->evtPost ^ me->evtAck;
+    uint8_t evtTsk = EVT_NONE;
+
+    while (0u != evtRdyMask) {
+        const uint8_t tsk = pv_cntLeadZero(evtRdyMask);
+
+        evtRdyMask &= ~EVT_BIT(tsk);
+
+        if (false == TKLSDLR_TSK_ACTIVE(p_tskLst, tsk)) { /* Task disabled? */
+            (void)pv_evtRel(me, tsk, tickCnt); /* Drop event */
+        } else {
+            const TKLtyp_tick_t dl =
+                (TKLtyp_tick_t)(tickCnt + TKLSDLR_TSK_DEADLINE(p_tskLst, tsk));
+
+            if ((EVT_NONE == evtTsk) ||
+                (true == pv_edfIsBefore(dl, tsk, *p_dl, evtTsk))) {
+                evtTsk = tsk;
+                *p_dl = dl;
+            }
+        }
+    } /* while (...) */
+
+    return (evtTsk);
+}
+#endif /* TKLSDLRCFG_EVT_ENA */
+#endif /* TKLSDLRCFG_EDF_ENA */
+
+/**
+ * \brief End scheduling algorithm execution cycle
+ *
+ * If no task was run, the custom idle hook (if defined) is run with the time
+ * until the next task release.  Determining that time costs another pass
+ * over the task list (with task list scan), but only when idle.
+ *
+ * \param isTskRun `true` if a task was run in this cycle
+ */
+static void pv_idle(TKLsdlr_ctx_t* const me, const bool isTskRun) {
+#ifdef TKLSDLRCFG_IDLE_HOOK
+    if (false == isTskRun) { /* Idle? */
+        TKLSDLRCFG_IDLE_HOOK(TKLsdlr_ctxCntTickToNextRel(me));
+    }
+#else
+    (void)me; /* Unused without idle hook */
+    (void)isTskRun;
+#endif /* TKLSDLRCFG_IDLE_HOOK */
+}
+
+#if !TKLSDLRCFG_PQ_ENA
+/**
+ * \brief Get time until next release of an enabled task with task list scan
+ *
+ * \param tickCnt Current relative system time tick count
+ *
+ * \return Number of time ticks until next task release
+ */
+static TKLtyp_tick_t pv_scanCntTickToNextRel(TKLsdlr_ctx_t* const me,
+                                             const TKLtyp_tick_t tickCnt) {
+    /* Set ptr. to task list */
+    const TKLsdlr_tskLst_t* const p_tskLst = me->p_tskLst;
+    const uint8_t tskCnt = me->tskCnt; /* Number of tasks in task list */
+    TKLtyp_tick_t tickToNextRel = TKLTYP_TICK_MAX; /* No enabled task (yet) */
+
+    /* Find earliest next release of all enabled tasks (still correct on tick
+       count rollover) */
+#if TKLSDLRCFG_ACT_MAP_ENA
+    for (uint8_t i = pv_actNext(me, 0u);
+         (tskCnt > i) && (0u < tickToNextRel);
+         i = pv_actNext(me, i + 1u)) {
+#else
+    for (uint8_t i = 0u; (tskCnt > i) && (0u < tickToNextRel); i++) {
+#endif /* TKLSDLRCFG_ACT_MAP_ENA */
+        const TKLtyp_tick_t period = TKLSDLR_TSK_PERIOD(p_tskLst, i);
+
+        /* Periodic task enabled? */
+        if ((true == TKLSDLR_TSK_ACTIVE(p_tskLst, i)) && (0u < period)) {
+            const TKLtyp_tick_t tickSinceLastRun =
+                tickCnt - TKLSDLR_TSK_LAST_RUN(p_tskLst, i);
+
+            if (tickSinceLastRun >= period) { /* Due to run? */
+                tickToNextRel = 0u;
+            } else if (period - tickSinceLastRun < tickToNextRel) {
+                tickToNextRel = period - tickSinceLastRun;
+            } else {
+                /* Do nothing (later release) */
+            }
+        }
+    } /* for (...) */
+
+    return (tickToNextRel);
+}
+#endif /* !TKLSDLRCFG_PQ_ENA */
+
+#if TKLSDLRCFG_EDF_ENA && !TKLSDLRCFG_PQ_ENA
+/**
+ * \brief Scheduling algorithm execution cycle with EDF scheduling policy and
+ * task list scan
+ *
+ * Same as the (fixed priority) task list scan, but the whole task list is
+ * scanned and the due-to-run task with the earliest absolute deadline is run.
+ * Disabled tasks are not run but still get their `lastRun` time updated.
+ *
+ * \param tickCnt Current relative system time tick count
+ *
+ * \return `true` if a task was run
+ */
+static bool pv_edfExec(TKLsdlr_ctx_t* const me, const TKLtyp_tick_t tickCnt) {
+    TKLsdlr_tskLst_t* const p_tskLst = me->p_tskLst; /* Set ptr. to task list */
+    const uint8_t tskCnt = me->tskCnt; /* Number of tasks in task list */
+    uint8_t edfTsk = EDF_NONE;
+    TKLtyp_tick_t edfDl = 0u;
+    bool isTskRun = false;
+
+#if TKLSDLRCFG_EVT_ENA
+    /* Sporadic tasks are only run on a pending event */
+    edfTsk = pv_edfEvtPeek(me, tickCnt, &edfDl);
+#endif /* TKLSDLRCFG_EVT_ENA */
+#if TKLSDLRCFG_ACT_MAP_ENA
+    /* Bring `lastRun` times of disabled tasks up to date once per half tick
+       count range */
+    if (0u != ((tickCnt ^ me->actTick) & ACT_TICK_MSB)) {
+        pv_actSync(me, tickCnt);
+    }
+    me->actTick = tickCnt;
+
+    /* Whole task list is reached, even if a task is run */
+    pv_actReach(me, (uint8_t)(tskCnt - 1u), tickCnt);
+
+    /* Skip disabled tasks (their `lastRun` time is updated lazily, on
+       re-activation) */
+    for (uint8_t i = pv_actNext(me, 0u);
+         i < tskCnt;
+         i = pv_actNext(me, i + 1u)) {
+#else
+    for (uint8_t i = 0u; i < tskCnt; i++) {
+#endif /* TKLSDLRCFG_ACT_MAP_ENA */
+#if TKLSDLRCFG_EVT_ENA
+        if (0u == TKLSDLR_TSK_PERIOD(p_tskLst, i)) { /* Sporadic task? */
+            /* Do nothing (pending event already considered) */
+        } else
+#endif /* TKLSDLRCFG_EVT_ENA */
+        /* Check if new execution period for task has started
+           (still correct on tick count rollover) */
+        if ((TKLtyp_tick_t)(tickCnt - TKLSDLR_TSK_LAST_RUN(p_tskLst, i)) >=
+            TKLSDLR_TSK_PERIOD(p_tskLst, i)) {
+            if (true == pv_isTskRunnable(me, i)) { /* Task enabled? */
+                const TKLtyp_tick_t dl = pv_edfDl(me, i);
+
+                if ((EDF_NONE == edfTsk) ||
+                    (true == pv_edfIsBefore(dl, i, edfDl, edfTsk))) {
+                    edfTsk = i;
+                    edfDl = dl;
+                }
+            } else {
+                /* Save (ideal) time of when task was "ready-to-run" */
+                TKLSDLR_TSK_LAST_RUN(p_tskLst, i) = pv_calcRel(me, i, tickCnt);
+            }
+        } /* if (...) */
+    } /* for (...) */
+
+#if TKLSDLRCFG_EVT_ENA
+    if ((EDF_NONE != edfTsk) &&
+        (0u == TKLSDLR_TSK_PERIOD(p_tskLst, edfTsk))) { /* Sporadic task? */
+        isTskRun = pv_evtRel(me, edfTsk, tickCnt);
+    } else
+#endif /* TKLSDLRCFG_EVT_ENA */
+    if (EDF_NONE != edfTsk) {
+        /* Save (ideal) time of when task was "ready-to-run" */
+        TKLSDLR_TSK_LAST_RUN(p_tskLst, edfTsk) =
+            pv_calcRel(me, edfTsk, tickCnt);
+        pv_runTsk(me, edfTsk, tickCnt);
+        isTskRun = true;
+    }
+
+    return (isTskRun);
+}
+#endif /* TKLSDLRCFG_EDF_ENA && !TKLSDLRCFG_PQ_ENA */
+
+#if TKLSDLRCFG_PQ_ENA
+/**
+ * \brief Check if a task is released before another one
+ *
+ * Still correct on tick count rollover, as long as both next release ticks
+ * are less than half the tick count range apart.
+ *
+ * \param tskA Task index
+ * \param tskB Task index
+ *
+ * \return `true` if task `tskA` is released before task `tskB`
+ */
+static bool pv_pqIsRelBefore(TKLsdlr_ctx_t* const me,
+                             const uint8_t tskA,
+                             const uint8_t tskB) {
+    const TKLsdlr_tskLst_t* const p_tskLst = me->p_tskLst;
+    const TKLtyp_tick_t relA = TKLSDLR_TSK_LAST_RUN(p_tskLst, tskA) +
+                               TKLSDLR_TSK_PERIOD(p_tskLst, tskA);
+    const TKLtyp_tick_t relB = TKLSDLR_TSK_LAST_RUN(p_tskLst, tskB) +
+                               TKLSDLR_TSK_PERIOD(p_tskLst, tskB);
+    const TKLtyp_tick_t delta = relB - relA;
+
+    return ((0u != delta) && ((TKLTYP_TICK_MAX / 2u) >= delta));
+}
+
+/**
+ * \brief Place task at given position within release heap
+ *
+ * \param pos Position within release heap
+ * \param tsk Task index
+ */
+static void pv_pqRelPlace(TKLsdlr_ctx_t* const me,
+                          const uint8_t pos,
+                          const uint8_t tsk) {
+    me->pqRelHeap[pos] = tsk;
+    me->pqRelPos[tsk] = pos;
+}
+
+/**
+ * \brief Restore release heap order by moving a task towards the root
+ *
+ * \param pos Position of task within release heap
+ */
+static void pv_pqRelSiftUp(TKLsdlr_ctx_t* const me, uint8_t pos) {
+    const uint8_t tsk = me->pqRelHeap[pos];
+
+    while (0u < pos) {
+        const uint8_t parent = (uint8_t)((pos - 1u) / 2u);
+
+        if (false == pv_pqIsRelBefore(me, tsk, me->pqRelHeap[parent])) {
+            break; /* Heap order restored */
+        }
+        pv_pqRelPlace(me, pos, me->pqRelHeap[parent]);
+        pos = parent;
+    }
+    pv_pqRelPlace(me, pos, tsk);
+}
+
+/**
+ * \brief Restore release heap order by moving a task towards the leaves
+ *
+ * \param pos Position of task within release heap
+ */
+static void pv_pqRelSiftDown(TKLsdlr_ctx_t* const me, uint8_t pos) {
+    const uint8_t tsk = me->pqRelHeap[pos];
+    const uint8_t cnt = me->pqRelCnt;
+
+    while (cnt > (2u * pos) + 1u) { /* Has (at least left) child? */
+        uint8_t child = (uint8_t)((2u * pos) + 1u);
+
+        if ((cnt > child + 1u) &&
+            (true == pv_pqIsRelBefore(me, me->pqRelHeap[child + 1u],
+                                      me->pqRelHeap[child]))) {
+            child++; /* Right child is released earlier */
+        }
+        if (false == pv_pqIsRelBefore(me, me->pqRelHeap[child], tsk)) {
+            break; /* Heap order restored */
+        }
+        pv_pqRelPlace(me, pos, me->pqRelHeap[child]);
+        pos = child;
+    }
+    pv_pqRelPlace(me, pos, tsk);
+}
+
+/**
+ * \brief Insert task into release heap
+ *
+ * \param tsk Task index
+ */
+static void pv_pqRelPush(TKLsdlr_ctx_t* const me, const uint8_t tsk) {
+    const uint8_t pos = me->pqRelCnt;
+
+    me->pqRelCnt++;
+    pv_pqRelPlace(me, pos, tsk);
+    pv_pqRelSiftUp(me, pos);
+}
+
+/**
+ * \brief Remove task with earliest next release from release heap
+ *
+ * \return Task index
+ */
+static uint8_t pv_pqRelPop(TKLsdlr_ctx_t* const me) {
+    const uint8_t tsk = me->pqRelHeap[0];
+
+    me->pqRelCnt--;
+    if (0u < me->pqRelCnt) {
+        /* Last task to root */
+        pv_pqRelPlace(me, 0u, me->pqRelHeap[me->pqRelCnt]);
+        pv_pqRelSiftDown(me, 0u);
+    }
+    me->pqRelPos[tsk] = PQ_NONE;
+
+    return (tsk);
+}
+
+/**
+ * \brief Check if a task within ready heap is to be run before another one
+ *
+ * \param tskA Task index
+ * \param tskB Task index
+ *
+ * \return `true` if task `tskA` has higher priority (lower index or, with
+ * deadline-monotonic dispatch order, lower position within dispatch order)
+ * or, with EDF scheduling policy, earlier absolute deadline than task `tskB`
+ */
+static bool pv_pqIsRdyBefore(const TKLsdlr_ctx_t* const me,
+                             const uint8_t tskA,
+                             const uint8_t tskB) {
+#if TKLSDLRCFG_EDF_ENA
+    return (pv_edfIsBefore(me->pqRdyDl[tskA], tskA, me->pqRdyDl[tskB], tskB));
+#elif TKLSDLRCFG_DM_ORDER_ENA
+    return (me->dispPrio[tskA] < me->dispPrio[tskB]);
+#else
+    (void)me; /* Unused without EDF scheduling policy */
+
+    return (tskA < tskB);
+#endif /* TKLSDLRCFG_EDF_ENA */
+}
+
+/**
+ * \brief Insert task into ready heap
+ *
+ * \param tsk Task index
+ */
+static void pv_pqRdyPush(TKLsdlr_ctx_t* const me, const uint8_t tsk) {
+    uint8_t pos = me->pqRdyCnt;
+
+#if TKLSDLRCFG_EDF_ENA
+    me->pqRdyDl[tsk] = pv_edfDl(me, tsk);
+#endif /* TKLSDLRCFG_EDF_ENA */
+    me->pqRdyCnt++;
+    while ((0u < pos) &&
+           (true == pv_pqIsRdyBefore(me, tsk,
+                                     me->pqRdyHeap[(pos - 1u) / 2u]))) {
+        me->pqRdyHeap[pos] = me->pqRdyHeap[(pos - 1u) / 2u];
+        pos = (uint8_t)((pos - 1u) / 2u);
+    }
+    me->pqRdyHeap[pos] = tsk;
+}
+
+/**
+ * \brief Remove task with highest priority (lowest index or, with EDF
+ * scheduling policy, earliest absolute deadline) from ready heap
+ *
+ * \return Task index
+ */
+static uint8_t pv_pqRdyPop(TKLsdlr_ctx_t* const me) {
+    const uint8_t tsk = me->pqRdyHeap[0];
+
+    me->pqRdyCnt--;
+
+    const uint8_t last = me->pqRdyHeap[me->pqRdyCnt];
+    const uint8_t cnt = me->pqRdyCnt;
+    uint8_t pos = 0u;
+
+    while (cnt > (2u * pos) + 1u) { /* Has (at least left) child? */
+        uint8_t child = (uint8_t)((2u * pos) + 1u);
+
+        if ((cnt > child + 1u) &&
+            (true == pv_pqIsRdyBefore(me, me->pqRdyHeap[child + 1u],
+                                      me->pqRdyHeap[child]))) {
+            child++; /* Right child has higher priority */
+        }
+        if (false == pv_pqIsRdyBefore(me, me->pqRdyHeap[child], last)) {
+            break; /* Heap order restored */
+        }
+        me->pqRdyHeap[pos] = me->pqRdyHeap[child];
+        pos = child;
+    }
+    me->pqRdyHeap[pos] = last;
+
+    return (tsk);
+}
+
+/**
+ * \brief Build index of task list (all tasks into release heap)
+ *
+ * \param tskCnt Number of tasks within registered task list
+ */
+static void pv_pqInit(TKLsdlr_ctx_t* const me, const uint8_t tskCnt) {
+    me->pqRelCnt = 0u;
+    me->pqRdyCnt = 0u;
+    for (uint8_t i = 0u; tskCnt > i; i++) {
+#if TKLSDLRCFG_EVT_ENA
+        if (0u == TKLSDLR_TSK_PERIOD(me->p_tskLst, i)) { /* Sporadic task? */
+            me->pqRelPos[i] = PQ_NONE; /* Only released by events */
+        } else
+#endif /* TKLSDLRCFG_EVT_ENA */
+        {
+            pv_pqRelPush(me, i);
+        }
+    }
+}
+
+/**
+ * \brief Scheduling algorithm execution cycle with priority queue engine
+ *
+ * Same semantics as the task list scan, but only released tasks are touched.
+ *
+ * \param tickCnt Current relative system time tick count
+ *
+ * \return `true` if a task was run
+ */
+static bool pv_pqExec(TKLsdlr_ctx_t* const me, const TKLtyp_tick_t tickCnt) {
+    TKLsdlr_tskLst_t* const p_tskLst = me->p_tskLst; /* Set ptr. to task list */
+    bool isTskRun = false;
+
+    /* Move all tasks with a new execution period (still correct on tick count
+       rollover) from release to ready heap; O(1) if none is due */
+    while ((0u < me->pqRelCnt) &&
+           ((TKLtyp_tick_t)(tickCnt -
+                            TKLSDLR_TSK_LAST_RUN(p_tskLst, me->pqRelHeap[0])) >=
+            TKLSDLR_TSK_PERIOD(p_tskLst, me->pqRelHeap[0]))) {
+        pv_pqRdyPush(me, pv_pqRelPop(me));
+    }
+
+#if TKLSDLRCFG_EVT_ENA && TKLSDLRCFG_EDF_ENA
+    /* Handle pending event first if of earlier absolute deadline than all
+       released tasks */
+    TKLtyp_tick_t evtDl = 0u;
+    const uint8_t evtTsk = pv_edfEvtPeek(me, tickCnt, &evtDl);
+
+    if ((EVT_NONE != evtTsk) &&
+        ((0u == me->pqRdyCnt) ||
+         (true == pv_edfIsBefore(evtDl, evtTsk,
+                                 me->pqRdyDl[me->pqRdyHeap[0]],
+                                 me->pqRdyHeap[0])))) {
+        isTskRun = pv_evtRel(me, evtTsk, tickCnt);
+    }
+#elif TKLSDLRCFG_EVT_ENA
+    /* Handle pending event first if of higher priority than all released
+       tasks */
+    const uint8_t evtTsk = pv_evtPeek(me);
+
+    if ((EVT_NONE != evtTsk) &&
+        ((0u == me->pqRdyCnt) ||
+         (true == pv_pqIsRdyBefore(me, evtTsk, me->pqRdyHeap[0])))) {
+        isTskRun = pv_evtRel(me, evtTsk, tickCnt);
+    }
+#endif /* TKLSDLRCFG_EVT_ENA && TKLSDLRCFG_EDF_ENA */
+
+    /* Handle released tasks in task list order (priority) or, with EDF
+       scheduling policy, in order of their absolute deadlines.
+       Disabled tasks are not run but still get their `lastRun` time updated.
+       If a task was run, end cycle. */
+    while ((false == isTskRun) && (0u < me->pqRdyCnt)) {
+        const uint8_t tsk = pv_pqRdyPop(me);
+
+        /* Still released (`lastRun` might have been updated meanwhile)? */
+        if ((TKLtyp_tick_t)(tickCnt - TKLSDLR_TSK_LAST_RUN(p_tskLst, tsk)) >=
+            TKLSDLR_TSK_PERIOD(p_tskLst, tsk)) {
+            /* Save (ideal) time of when task was "ready-to-run" */
+            TKLSDLR_TSK_LAST_RUN(p_tskLst, tsk) = pv_calcRel(me, tsk, tickCnt);
+            pv_pqRelPush(me, tsk);
+
+            if (true == pv_isTskRunnable(me, tsk)) { /* Task enabled? */
+                pv_runTsk(me, tsk, tickCnt);
+                isTskRun = true;
+
+                break; /* End cycle to allow starting new one as soon as
+                          possible (gives better schedulability) */
+            }
+        } else {
+            pv_pqRelPush(me, tsk);
+        }
+    } /* while (...) */
+
+    return (isTskRun);
+}
+
+/**
+ * \brief Get time until next task release with priority queue engine
+ *
+ * Disabled tasks are not filtered (that would need a task list scan), so the
+ * result might be earlier than the next release of an enabled task.
+ *
+ * \param tickCnt Current relative system time tick count
+ *
+ * \return Number of time ticks until next task release
+ */
+static TKLtyp_tick_t pv_pqCntTickToNextRel(TKLsdlr_ctx_t* const me,
+                                           const TKLtyp_tick_t tickCnt) {
+    /* Set ptr. to task list */
+    const TKLsdlr_tskLst_t* const p_tskLst = me->p_tskLst;
+    TKLtyp_tick_t tickToNextRel = 0u; /* Released task(s) pending */
+
+    if ((0u == me->pqRdyCnt) && (0u == me->pqRelCnt)) { /* Sporadic only? */
+        tickToNextRel = TKLTYP_TICK_MAX;
+    } else if (0u == me->pqRdyCnt) { /* No released task pending? */
+        const uint8_t tsk = me->pqRelHeap[0];
+        const TKLtyp_tick_t period = TKLSDLR_TSK_PERIOD(p_tskLst, tsk);
+        const TKLtyp_tick_t tickSinceLastRun =
+            tickCnt - TKLSDLR_TSK_LAST_RUN(p_tskLst, tsk);
+
+        if (tickSinceLastRun < period) { /* Not yet due to run? */
+            tickToNextRel = period - tickSinceLastRun;
+        }
+    }
+
+    return (tickToNextRel);
+}
+#endif /* TKLSDLRCFG_PQ_ENA */
+
+#if TKLSDLRCFG_RELTBL_ENA
+/**
+ * \brief Release tasks of a release slot
+ *
+ * \param relTick Time of release slot
+ * \param tskMask Tasks released at this time
+ */
+static void pv_relTblRel(TKLsdlr_ctx_t* const me,
+                         const TKLtyp_tick_t relTick,
+                         uint32_t tskMask) {
+    TKLsdlr_tskLst_t* const p_tskLst = me->p_tskLst; /* Set ptr. to task list */
+
+    while (0u != tskMask) {
+        const uint8_t tsk = pv_findFirstSet(tskMask);
+
+        tskMask &= tskMask - 1u; /* Clear lowest set bit */
+
+        /* First release (after initial offset) reached?
+           (still correct on tick count rollover) */
+        if ((TKLtyp_tick_t)(relTick - TKLSDLR_TSK_LAST_RUN(p_tskLst, tsk)) >=
+            TKLSDLR_TSK_PERIOD(p_tskLst, tsk)) {
+            /* Save (ideal) time of when task was "ready-to-run" */
+            TKLSDLR_TSK_LAST_RUN(p_tskLst, tsk) = relTick;
+            me->relTblRdyMask |= (uint32_t)1u << tsk;
+        }
+    } /* while (...) */
+}
+
+/**
+ * \brief Release tasks of all release slots reached up to current time
+ *
+ * \param tickCnt Current relative system time tick count
+ */
+static void pv_relTblRelUpTo(TKLsdlr_ctx_t* const me,
+                             const TKLtyp_tick_t tickCnt) {
+    const TKLtyp_relTbl_t* const p_relTbl = me->p_relTbl;
+    const TKLtyp_tick_t hyperperiod = p_relTbl->hyperperiod;
+    TKLtyp_tick_t hpTick = tickCnt - me->relTblBase; /* Time since begin of
+                                                        curr. hyperperiod */
+
+    /* Skip hyperperiods lost entirely (e.g., on late scheduler start); all
+       tasks are released within the last full hyperperiod anyway.  Detected
+       via compares only, so that the (rare) division is only done then */
+    if ((hpTick >= hyperperiod) &&
+        ((TKLtyp_tick_t)(hpTick - hyperperiod) >= hyperperiod)) {
+        const TKLtyp_tick_t skip =
+            (TKLtyp_tick_t)(((hpTick / hyperperiod) - 1u) * hyperperiod);
+
+        me->relTblBase += skip;
+        me->relTblIdx = 0u;
+        hpTick -= skip;
+    }
+
+    /* Walk release slots up to curr. time */
+    for (;;) {
+        if (p_relTbl->slotCnt == me->relTblIdx) { /* End of hyperperiod? */
+            if (hyperperiod > hpTick) {
+                break; /* Next hyperperiod not yet started */
+            }
+            me->relTblBase += hyperperiod;
+            me->relTblIdx = 0u;
+            hpTick -= hyperperiod;
+        } else if (hpTick >= p_relTbl->p_slot[me->relTblIdx].tick) {
+            pv_relTblRel(me,
+                         me->relTblBase + p_relTbl->p_slot[me->relTblIdx].tick,
+                         p_relTbl->p_slot[me->relTblIdx].tskMask);
+            me->relTblIdx++;
+        } else {
+            break; /* Next release slot not yet reached */
+        }
+    } /* for (...) */
+}
+
+/**
+ * \brief Get time until next release slot with release table
+ *
+ * Disabled tasks are not filtered, so the result might be earlier than the
+ * next release of an enabled task.
+ *
+ * \param tickCnt Current relative system time tick count
+ *
+ * \return Number of time ticks until next release slot
+ */
+static TKLtyp_tick_t pv_relTblCntTickToNextRel(TKLsdlr_ctx_t* const me,
+                                               const TKLtyp_tick_t tickCnt) {
+    const TKLtyp_relTbl_t* const p_relTbl = me->p_relTbl;
+    /* Time since begin of curr. hyperperiod */
+    const TKLtyp_tick_t hpTick = tickCnt - me->relTblBase;
+    TKLtyp_tick_t nextRelTick = 0u; /* Released task(s) pending */
+
+    if (0u == me->relTblRdyMask) { /* No released task pending? */
+        nextRelTick = (p_relTbl->slotCnt == me->relTblIdx) ?
+                      p_relTbl->hyperperiod + p_relTbl->p_slot[0].tick :
+                      p_relTbl->p_slot[me->relTblIdx].tick;
+    }
+
+    /* Next release slot already reached (but not yet walked)? */
+    return ((hpTick >= nextRelTick) ?
+            0u : (TKLtyp_tick_t)(nextRelTick - hpTick));
+}
+#endif /* TKLSDLRCFG_RELTBL_ENA */
+
+/**
+ * \brief Get time stamp for task (de)activation
+ *
+ * The time tick is only queried if needed (for `lastRun` update, trace or lazy
+ * `lastRun` update), and only once per call of the public API.
+ *
+ * \param updLastRun Directive to update time stamp of last task run
+ *
+ * \return Current relative system time tick count (`0` if not needed)
+ */
+static TKLtyp_tick_t pv_getSetTskActTick(const TKLsdlr_ctx_t* const me,
+                                         const bool updLastRun) {
+    TKLtyp_tick_t tickCnt = 0u;
+
+#if TKLSDLRCFG_TRACE_ENA || TKLSDLRCFG_ACT_MAP_ENA
+    (void)updLastRun; /* Always needed */
+#else
+    if (true == updLastRun) /* Update last run? */
+#endif /* TKLSDLRCFG_TRACE_ENA || TKLSDLRCFG_ACT_MAP_ENA */
+    {
+        tickCnt = (*me->p_getTick)();
+    }
+
+    return (tickCnt);
+}
+
+/**
+ * \brief Activate/deactivate a task within registered task list
+ *
+ * \param tskIdx Index of task within task list
+ * \param active Desired task activation status
+ * \param updLastRun Directive to update time stamp of last task run
+ * \param tickCnt Current relative system time tick count (see
+ * \ref pv_getSetTskActTick())
+ */
+static void pv_setTskAct(TKLsdlr_ctx_t* const me,
+                         const uint8_t tskIdx,
+                         const bool active,
+                         const bool updLastRun,
+                         const TKLtyp_tick_t tickCnt) {
+    TKLsdlr_tskLst_t* const p_tskLst = me->p_tskLst;
+
+#if TKLSDLRCFG_TRACE_ENA
+    /* Activation status changes? */
+    if (active != TKLSDLR_TSK_ACTIVE(p_tskLst, tskIdx)) {
+        pv_trace(me,
+                 (true == active) ? TKLTYP_TRACE_ENA : TKLTYP_TRACE_DIS,
+                 tskIdx,
+                 tickCnt);
+    }
+#endif /* TKLSDLRCFG_TRACE_ENA */
+#if TKLSDLRCFG_ACT_MAP_ENA
+    if (false == active) {
+#if TKLSDLRCFG_EDF_ENA
+        /* Task list scan records of the EDF scheduling policy also reach
+           enabled tasks that were due but not run, so they must not apply to
+           this task.  Bring other disabled tasks up to date and drop them. */
+        if (true == TKLSDLR_TSK_ACTIVE(p_tskLst, tskIdx)) {
+            pv_actSync(me, tickCnt);
+        }
+#endif /* TKLSDLRCFG_EDF_ENA */
+        me->actMap[tskIdx / 32u] &= ~ACT_BIT(tskIdx);
+    } else if (false == TKLSDLR_TSK_ACTIVE(p_tskLst, tskIdx)) {
+        /* Re-activation */
+        /* Catch up on skipped `lastRun` time updates */
+        pv_actUpdLastRun(me, tskIdx, tickCnt);
+        me->actMap[tskIdx / 32u] |= ACT_BIT(tskIdx);
+    } else {
+        /* Do nothing (already enabled) */
+    }
+#endif /* TKLSDLRCFG_ACT_MAP_ENA */
+    TKLSDLR_TSK_ACTIVE(p_tskLst, tskIdx) = active;
+
+    if (true == updLastRun) { /* Update last run? */
+        /* Update time stamp */
+        TKLSDLR_TSK_LAST_RUN(p_tskLst, tskIdx) = tickCnt;
+
+#if TKLSDLRCFG_PQ_ENA
+        if (PQ_NONE != me->pqRelPos[tskIdx]) { /* Within release heap? */
+            /* Re-establish release order for changed `lastRun`
+               (tasks within ready heap are re-checked on exec.) */
+            pv_pqRelSiftUp(me, me->pqRelPos[tskIdx]);
+            pv_pqRelSiftDown(me, me->pqRelPos[tskIdx]);
+        }
+#endif /* TKLSDLRCFG_PQ_ENA */
+    }
+}
+
+#if TKLSDLRCFG_MODE_CHG_ENA
+/**
+ * \brief Carry task phases over to requested task list
+ *
+ * Tasks shared with the registered task list (same task runner) take over
+ * its `lastRun` time.  Other periodic tasks drop releases missed before the
+ * switch (but not one at the time of the switch).
+ *
+ * \param switchTick Time of switch
+ * \param tickCnt Current relative system time tick count
+ */
+static void pv_modeChgPhase(TKLsdlr_ctx_t* const me,
+                            const TKLtyp_tick_t switchTick,
+                            const TKLtyp_tick_t tickCnt) {
+    TKLsdlr_tskLst_t* const p_reqTskLst = me->p_reqTskLst;
+    const TKLsdlr_tskLst_t* const p_tskLst = me->p_tskLst;
+    const uint8_t tskCnt = me->tskCnt; /* Number of tasks in task list */
+
+#if TKLSDLRCFG_ACT_MAP_ENA
+    pv_actSync(me, tickCnt); /* `lastRun` times of disabled tasks */
+#else
+    (void)tickCnt;
+#endif /* TKLSDLRCFG_ACT_MAP_ENA */
+
+    for (uint8_t j = 0u; me->reqTskCnt > j; j++) {
+        const TKLtyp_tick_t period = TKLSDLR_TSK_PERIOD(p_reqTskLst, j);
+        const TKLtyp_tick_t tickSinceLastRun =
+            (TKLtyp_tick_t)(switchTick - TKLSDLR_TSK_LAST_RUN(p_reqTskLst, j));
+        uint8_t i = 0u;
+
+        /* Find first task with matching function ptr. (same task list
+           matches each task itself) */
+        if (p_reqTskLst == p_tskLst) {
+            i = j;
+        } else {
+            while ((tskCnt > i) &&
+                   (*TKLSDLR_TSK_RUNNER(p_reqTskLst, j) !=
+                    (*TKLSDLR_TSK_RUNNER(p_tskLst, i)))) {
+                i++;
+            }
+        }
+
+        if (tskCnt > i) { /* Shared task? */
+            TKLSDLR_TSK_LAST_RUN(p_reqTskLst, j) =
+                TKLSDLR_TSK_LAST_RUN(p_tskLst, i);
+        } else if ((0u < period) && (tickSinceLastRun > period)) {
+            /* Latest release up to switch (still correct on tick count
+               rollover); one at the time of the switch stays due */
+            const TKLtyp_tick_t tickSinceRel = tickSinceLastRun % period;
+
+            TKLSDLR_TSK_LAST_RUN(p_reqTskLst, j) = (TKLtyp_tick_t)(
+                switchTick - ((0u == tickSinceRel) ? period : tickSinceRel));
+        }
+    } /* for (...) */
+}
+
+/**
+ * \brief Switch to requested task list once time of mode change is reached
+ *
+ * Called at the start of a cycle, i.e. while no task runs.
+ *
+ * \param tickCnt Current relative system time tick count
+ */
+static void pv_modeChg(TKLsdlr_ctx_t* const me, const TKLtyp_tick_t tickCnt) {
+    /* Count tick count rollovers, so that hyperperiod boundaries stay aligned
+       with task phases (counted from `0`) also for non-power of 2
+       hyperperiods */
+    if (tickCnt < me->modeChgTickPrev) {
+        me->modeChgWrapCnt++;
+    }
+    me->modeChgTickPrev = tickCnt;
+
+    if (me->modeChgReq != me->modeChgAck) { /* Request pending? */
+        if (false == me->isModeChgTick) { /* First cycle since request? */
+            const TKLtyp_tick_t hyperperiod = me->reqHyperperiod;
+            TKLtyp_tick_t tickToSwitch = 0u; /* Switch now ... */
+
+            if (0u < hyperperiod) { /* ... or at next multiple of it */
+                /* Time tick count since `0` (with 64 bit time ticks, which
+                   practically never roll over, the tick count range wraps to
+                   `0`, so that rollovers drop out) */
+                const uint64_t tickAbs =
+                    ((uint64_t)me->modeChgWrapCnt *
+                     ((uint64_t)TKLTYP_TICK_MAX + 1u)) + tickCnt;
+
+                tickToSwitch = (TKLtyp_tick_t)((hyperperiod -
+                                                (tickAbs % hyperperiod)) %
+                                               hyperperiod);
+            }
+            me->modeChgTick = (TKLtyp_tick_t)(tickCnt + tickToSwitch);
+            me->isModeChgTick = true;
+        }
+
+        /* Time of mode change reached (still correct on tick count
+           rollover)? */
+        if ((TKLtyp_tick_t)(tickCnt - me->modeChgTick) <=
+            (TKLTYP_TICK_MAX / 2u)) {
+            pv_modeChgPhase(me, me->modeChgTick, tickCnt);
+            TKLsdlr_ctxSetTskLst(me, me->p_reqTskLst, me->reqTskCnt);
+            me->isModeChgTick = false;
+            me->modeChgAck = me->modeChgReq; /* Release request buffer */
+        }
+    }
+}
+#endif /* TKLSDLRCFG_MODE_CHG_ENA */
+
 #ifdef TEST
 /**
  * \brief "Invisible" API for unit tests to modify the internal state (private
@@ -33,83 +1813,548 @@ static volatile uint8_t pv_tskOverrunCnt;
  * \param tskCnt Number of tasks within provided task list
  */
 void TKLsdlr_utModTickSrcTskLst(const TKLtyp_p_getTick_t p_getTick,
-                                TKLtyp_tsk_t* const p_tskLst,
+                                TKLsdlr_tskLst_t* const p_tskLst,
                                 const uint8_t tskCnt) {
-    pv_p_getTick = p_getTick;
-    pv_p_tskLst = p_tskLst;
-    pv_tskCnt = tskCnt;
+    TKLsdlr_ctx_t* const me = &pv_ctx; /* Default instance */
+
+    me->p_getTick = p_getTick;
+#if TKLSDLRCFG_TS_ENA
+    me->p_getTs = NULL;
+#endif /* TKLSDLRCFG_TS_ENA */
+    me->p_tskLst = p_tskLst;
+    me->tskCnt = tskCnt;
+
+#if TKLSDLRCFG_DM_ORDER_ENA
+    pv_dispInit(me, (NULL != p_tskLst) ? tskCnt : 0u);
+#endif /* TKLSDLRCFG_DM_ORDER_ENA */
+#if TKLSDLRCFG_PQ_ENA
+    pv_pqInit(me, (NULL != p_tskLst) ? tskCnt : 0u);
+#endif /* TKLSDLRCFG_PQ_ENA */
+#if TKLSDLRCFG_RELTBL_ENA
+    me->p_relTbl = NULL;
+#endif /* TKLSDLRCFG_RELTBL_ENA */
+#if TKLSDLRCFG_CHAIN_ENA
+    me->p_chainTbl = NULL;
+    me->chainCur = CHAIN_NONE;
+    me->chainOverrunCnt = 0u;
+#endif /* TKLSDLRCFG_CHAIN_ENA */
+#if TKLSDLRCFG_STAT_ENA
+    pv_statClr(me);
+#endif /* TKLSDLRCFG_STAT_ENA */
+#if TKLSDLRCFG_TSK_OVERRUN_ENA
+    pv_tskOverrunClr(me);
+#endif /* TKLSDLRCFG_TSK_OVERRUN_ENA */
+#if TKLSDLRCFG_LOAD_ENA
+    me->loadSubWinCnt = UINT8_MAX;
+#endif /* TKLSDLRCFG_LOAD_ENA */
+#if TKLSDLRCFG_OVLD_ENA
+    pv_ovldInit(me, (NULL != p_tskLst) ? tskCnt : 0u);
+#endif /* TKLSDLRCFG_OVLD_ENA */
+#if TKLSDLRCFG_EVT_ENA
+    me->evtAck = me->evtPost;
+#endif /* TKLSDLRCFG_EVT_ENA */
+#if TKLSDLRCFG_MODE_CHG_ENA
+    me->modeChgAck = me->modeChgReq;
+    me->isModeChgTick = false;
+    me->modeChgTickPrev = 0u;
+    me->modeChgWrapCnt = 0u;
+#endif /* TKLSDLRCFG_MODE_CHG_ENA */
+#if TKLSDLRCFG_ACT_MAP_ENA
+    pv_actInit(me, (NULL != p_tskLst) ? tskCnt : 0u);
+#endif /* TKLSDLRCFG_ACT_MAP_ENA */
+#if TKLSDLRCFG_REL_RECIP_ENA
+    pv_relInit(me, (NULL != p_tskLst) ? tskCnt : 0u);
+#endif /* TKLSDLRCFG_REL_RECIP_ENA */
 }
 #endif /* TEST */
 
-void TKLsdlr_setTickSrc(const TKLtyp_p_getTick_t p_getTick) {
+TKLtyp_tick_t TKLsdlr_calcRel(const TKLtyp_tick_t period,
+                              const TKLtyp_tick_t lastRun,
+                              const TKLtyp_tick_t tickCnt,
+                              const TKLtyp_tick_t relRecip) {
+    const TKLtyp_tick_t tickSinceLastRun = tickCnt - lastRun;
+    TKLtyp_tick_t tickSinceRel;
+
+    /* No period lost? */
+    if ((TKLtyp_tick_t)(tickSinceLastRun - period) < period) {
+        tickSinceRel = tickSinceLastRun - period;
+    } else
+#if TKLSDLRCFG_REL_RECIP_ENA
+    if (0u == relRecip) { /* Power of 2 period? */
+        tickSinceRel = tickSinceLastRun & (TKLtyp_tick_t)(period - 1u);
+    } else {
+        /* Quotient via reciprocal is exact or (at most) one too small */
+        const TKLtyp_tick_t quot =
+            (TKLtyp_tick_t)(((REL_RECIP_PROD_T)tickSinceLastRun * relRecip) >>
+                            REL_RECIP_SHIFT);
+
+        tickSinceRel = tickSinceLastRun - (TKLtyp_tick_t)(quot * period);
+        if (tickSinceRel >= period) { /* Quotient one too small? */
+            tickSinceRel -= period;
+        }
+    }
+#else
+    {
+        (void)relRecip;
+        tickSinceRel = tickSinceLastRun % period;
+    }
+#endif /* TKLSDLRCFG_REL_RECIP_ENA */
+
+    return (tickCnt - tickSinceRel);
+}
+
+TKLtyp_tick_t TKLsdlr_calcRelRecip(const TKLtyp_tick_t period) {
+    return ((0u == (period & (period - 1u))) ? 0u :
+            (TKLtyp_tick_t)(TKLTYP_TICK_MAX / period));
+}
+
+void TKLsdlr_ctxInit(TKLsdlr_ctx_t* const me) {
+    assert(NULL != me); /* Sanity check (Design by Contract) */
+
+    (void)memset(me, 0, sizeof(*me));
+}
+
+void TKLsdlr_ctxSetTickSrc(TKLsdlr_ctx_t* const me,
+                           const TKLtyp_p_getTick_t p_getTick) {
     assert(NULL != p_getTick); /* Sanity check (Design by Contract) */
 
-    pv_p_getTick = p_getTick;
+    me->p_getTick = p_getTick;
 }
 
-void TKLsdlr_setTskLst(TKLtyp_tsk_t* const p_tskLst, const uint8_t tskCnt) {
+#if TKLSDLRCFG_TS_ENA
+void TKLsdlr_ctxSetTsSrc(TKLsdlr_ctx_t* const me,
+                         const TKLtyp_p_getTs_t p_getTs) {
+    assert(NULL != p_getTs); /* Sanity check (Design by Contract) */
+
+    me->p_getTs = p_getTs;
+}
+#endif /* TKLSDLRCFG_TS_ENA */
+
+void TKLsdlr_ctxSetTskLst(TKLsdlr_ctx_t* const me,
+                          TKLsdlr_tskLst_t* const p_tskLst,
+                          const uint8_t tskCnt) {
     /* Sanity check (Design by Contract) */
     assert((NULL != p_tskLst) &&
            (0u < tskCnt));
+#if TSK_STATE_ENA
+    assert(TKLSDLRCFG_TSK_CNT_MAX >= tskCnt);
+#endif /* TSK_STATE_ENA */
     for (uint8_t i = 0u; tskCnt > i; i++) {
-        assert((0u < p_tskLst[i].period) &&
-               (0u < p_tskLst[i].deadline) &&
-               (NULL != p_tskLst[i].p_tskRunner));
+#if TKLSDLRCFG_EVT_ENA
+        /* Sporadic tasks (`period` of `0`) must be within event bitmap */
+        assert((0u < TKLSDLR_TSK_PERIOD(p_tskLst, i)) || (32u > i));
+#else
+        assert(0u < TKLSDLR_TSK_PERIOD(p_tskLst, i));
+#endif /* TKLSDLRCFG_EVT_ENA */
+        assert((0u < TKLSDLR_TSK_DEADLINE(p_tskLst, i)) &&
+               (NULL != TKLSDLR_TSK_RUNNER(p_tskLst, i)));
     }
 
-    pv_p_tskLst = p_tskLst;
-    pv_tskCnt = tskCnt;
+    me->p_tskLst = p_tskLst;
+    me->tskCnt = tskCnt;
+
+#if TKLSDLRCFG_DM_ORDER_ENA
+    pv_dispInit(me, tskCnt); /* Before index of task list is built */
+#endif /* TKLSDLRCFG_DM_ORDER_ENA */
+#if TKLSDLRCFG_PQ_ENA
+    pv_pqInit(me, tskCnt);
+#endif /* TKLSDLRCFG_PQ_ENA */
+#if TKLSDLRCFG_RELTBL_ENA
+    me->p_relTbl = NULL; /* Release table belongs to previous task list */
+#endif /* TKLSDLRCFG_RELTBL_ENA */
+#if TKLSDLRCFG_CHAIN_ENA
+    me->p_chainTbl = NULL; /* Chains belong to previous task list */
+    me->chainCur = CHAIN_NONE;
+#endif /* TKLSDLRCFG_CHAIN_ENA */
+#if TKLSDLRCFG_STAT_ENA
+    pv_statClr(me); /* Statistics belong to previous task list */
+#endif /* TKLSDLRCFG_STAT_ENA */
+#if TKLSDLRCFG_TSK_OVERRUN_ENA
+    pv_tskOverrunClr(me); /* Records belong to previous task list */
+#endif /* TKLSDLRCFG_TSK_OVERRUN_ENA */
+#if TKLSDLRCFG_LOAD_ENA
+    me->loadSubWinCnt = UINT8_MAX; /* Restart CPU load measurement */
+#endif /* TKLSDLRCFG_LOAD_ENA */
+#if TKLSDLRCFG_OVLD_ENA
+    pv_ovldInit(me, tskCnt); /* Criticality levels of new task list */
+#endif /* TKLSDLRCFG_OVLD_ENA */
+#if TKLSDLRCFG_EVT_ENA
+    me->evtAck = me->evtPost; /* Events belong to previous task list */
+#endif /* TKLSDLRCFG_EVT_ENA */
+#if TKLSDLRCFG_ACT_MAP_ENA
+    pv_actInit(me, tskCnt);
+#endif /* TKLSDLRCFG_ACT_MAP_ENA */
+#if TKLSDLRCFG_REL_RECIP_ENA
+    pv_relInit(me, tskCnt); /* Reciprocals of periods of new task list */
+#endif /* TKLSDLRCFG_REL_RECIP_ENA */
 }
 
-TKLtyp_tsk_t* TKLsdlr_getTskLst(void) {
-    return (pv_p_tskLst);
+#if TKLSDLRCFG_MODE_CHG_ENA
+bool TKLsdlr_ctxReqTskLst(TKLsdlr_ctx_t* const me,
+                          TKLsdlr_tskLst_t* const p_tskLst,
+                          const uint8_t tskCnt,
+                          const TKLtyp_tick_t hyperperiod) {
+    /* Sanity check (Design by Contract) */
+    assert((NULL != p_tskLst) &&
+           (0u < tskCnt) &&
+           ((TKLTYP_TICK_MAX / 2u) >= hyperperiod));
+#if TSK_STATE_ENA
+    assert(TKLSDLRCFG_TSK_CNT_MAX >= tskCnt);
+#endif /* TSK_STATE_ENA */
+
+    bool isReq = false;
+
+    /* Only the requesting side writes the request buffer and `modeChgReq`,
+       and only while no request is pending (then, the scheduler does not
+       read the buffer), so neither side needs a critical region */
+    if (me->modeChgReq == me->modeChgAck) { /* No request pending? */
+        me->p_reqTskLst = p_tskLst;
+        me->reqTskCnt = tskCnt;
+        me->reqHyperperiod = hyperperiod;
+        me->modeChgReq = (false == me->modeChgReq); /* Publish request */
+        isReq = true;
+    }
+
+    return (isReq);
 }
+#endif /* TKLSDLRCFG_MODE_CHG_ENA */
 
-uint8_t TKLsdlr_cntTsk(void) {
-    return (pv_tskCnt);
+TKLsdlr_tskLst_t* TKLsdlr_ctxGetTskLst(const TKLsdlr_ctx_t* const me) {
+    return (me->p_tskLst);
 }
 
-uint8_t TKLsdlr_cntTskOverrun(void) {
-    return (pv_tskOverrunCnt);
+uint8_t TKLsdlr_ctxCntTsk(const TKLsdlr_ctx_t* const me) {
+    return (me->tskCnt);
 }
 
-void TKLsdlr_clrTskOverrun(void) {
-    pv_tskOverrunCnt = 0u;
+#if TKLSDLRCFG_DM_ORDER_ENA
+uint8_t TKLsdlr_ctxCntTskMisorder(const TKLsdlr_ctx_t* const me) {
+    return (me->dispMisorderCnt);
 }
 
-void TKLsdlr_setTskAct(const TKLtyp_p_tskRunner_t p_tskRunner,
-                       const bool active,
-                       const bool updLastRun) {
+uint8_t TKLsdlr_ctxGetDispTsk(const TKLsdlr_ctx_t* const me,
+                              const uint8_t prio) {
+    assert(me->tskCnt > prio); /* Sanity check (Design by Contract) */
+
+    return (me->dispOrder[prio]);
+}
+#endif /* TKLSDLRCFG_DM_ORDER_ENA */
+
+uint8_t TKLsdlr_ctxCntTskOverrun(const TKLsdlr_ctx_t* const me) {
+    return (me->tskOverrunCnt);
+}
+
+void TKLsdlr_ctxClrTskOverrun(TKLsdlr_ctx_t* const me) {
+    me->tskOverrunCnt = 0u;
+#if TKLSDLRCFG_TSK_OVERRUN_ENA
+    pv_tskOverrunClr(me);
+#endif /* TKLSDLRCFG_TSK_OVERRUN_ENA */
+}
+
+#if TKLSDLRCFG_TSK_OVERRUN_ENA
+void TKLsdlr_ctxGetTskOverrun(const TKLsdlr_ctx_t* const me,
+                              const uint8_t tskIdx,
+                              TKLtyp_tskOverrun_t* const p_tskOverrun) {
+    /* Sanity check (Design by Contract) */
+    assert((NULL != p_tskOverrun) &&
+           (me->tskCnt > tskIdx));
+
+    *p_tskOverrun = (TKLtyp_tskOverrun_t){
+        .cnt = me->tskOverrunCntPerTsk[tskIdx],
+        .lastTick = me->tskOverrunLastTick[tskIdx],
+#if TKLSDLRCFG_TS_ENA
+        .lastExecTs = me->tskOverrunLastExecTs[tskIdx],
+#endif /* TKLSDLRCFG_TS_ENA */
+        .worstLateness = me->tskOverrunWorstLateness[tskIdx]};
+}
+
+uint8_t TKLsdlr_ctxGetLastOverrunTsk(const TKLsdlr_ctx_t* const me) {
+    return (me->lastOverrunTsk);
+}
+#endif /* TKLSDLRCFG_TSK_OVERRUN_ENA */
+
+#if TKLSDLRCFG_STAT_ENA
+void TKLsdlr_ctxGetTskStat(const TKLsdlr_ctx_t* const me,
+                           const uint8_t tskIdx,
+                           TKLtyp_tskStat_t* const p_tskStat) {
+    /* Sanity check (Design by Contract) */
+    assert((NULL != p_tskStat) &&
+           (me->tskCnt > tskIdx));
+
+    const TKLsdlr_statAcc_t* const p_stat = &me->tskStat[tskIdx];
+
+    if (0u < p_stat->runCnt) { /* Task run at least once? */
+        *p_tskStat = (TKLtyp_tskStat_t){
+            .runCnt = p_stat->runCnt,
+            .execMin = p_stat->execMin,
+            .execMax = p_stat->execMax,
+            .execMean = (TKLtyp_tick_t)(p_stat->execSum / p_stat->runCnt),
+            .respMin = p_stat->respMin,
+            .respMax = p_stat->respMax,
+            .respMean = (TKLtyp_tick_t)(p_stat->respSum / p_stat->runCnt),
+#if TKLSDLRCFG_TS_ENA
+            .execTsMin = p_stat->execTsMin,
+            .execTsMax = p_stat->execTsMax,
+            .execTsMean = (uint32_t)(p_stat->execTsSum / p_stat->runCnt),
+#endif /* TKLSDLRCFG_TS_ENA */
+            .relJitter = p_stat->startDlyMax - p_stat->startDlyMin};
+    } else {
+        *p_tskStat = (TKLtyp_tskStat_t){.runCnt = 0u};
+    }
+}
+
+void TKLsdlr_ctxClrTskStat(TKLsdlr_ctx_t* const me) {
+    pv_statClr(me);
+}
+#endif /* TKLSDLRCFG_STAT_ENA */
+
+void TKLsdlr_ctxSetTskAct(TKLsdlr_ctx_t* const me,
+                          const TKLtyp_p_tskRunner_t p_tskRunner,
+                          const bool active,
+                          const bool updLastRun) {
     /* Sanity check (Design by Contract) */
     assert((NULL != p_tskRunner) &&
-           (NULL != pv_p_getTick) &&
-           (NULL != pv_p_tskLst) &&
-           (0u < pv_tskCnt));
+           (NULL != me->p_getTick) &&
+           (NULL != me->p_tskLst) &&
+           (0u < me->tskCnt));
+#if TKLSDLRCFG_RELTBL_ENA
+    /* Release times must keep matching release table */
+    assert((NULL == me->p_relTbl) || (false == updLastRun));
+#endif /* TKLSDLRCFG_RELTBL_ENA */
 
-    TKLtyp_tsk_t* const p_tskLst = pv_p_tskLst; /* Set ptr. to task list */
-    const uint8_t tskCnt = pv_tskCnt; /* Number of tasks in task list */
+    /* Set ptr. to task list */
+    const TKLsdlr_tskLst_t* const p_tskLst = me->p_tskLst;
+    const uint8_t tskCnt = me->tskCnt; /* Number of tasks in task list */
+    const TKLtyp_tick_t tickCnt = pv_getSetTskActTick(me, updLastRun);
 
     /* Find all tasks (matching function ptr.) and set them to "on"/"off" */
     for (uint8_t i = 0u; tskCnt > i; i++) {
-        if (*p_tskRunner == (*p_tskLst[i].p_tskRunner)) { /* Task runner match? */
-            p_tskLst[i].active = active;
-
-            if (true == updLastRun) { /* Update last run? */
-                p_tskLst[i].lastRun = (*pv_p_getTick)(); /* Update time stamp */
-            }
+        /* Task runner match? */
+        if (*p_tskRunner == (*TKLSDLR_TSK_RUNNER(p_tskLst, i))) {
+            pv_setTskAct(me, i, active, updLastRun, tickCnt);
         }
     } /* for (...) */
 }
 
-void TKLsdlr_exec(void) {
+uint8_t TKLsdlr_ctxGetTskIdx(const TKLsdlr_ctx_t* const me,
+                             const TKLtyp_p_tskRunner_t p_tskRunner) {
+    /* Sanity check (Design by Contract) */
+    assert((NULL != p_tskRunner) &&
+           (NULL != me->p_tskLst));
+
+    uint8_t tskIdx = 0u;
+
+    /* Find first task with matching function ptr. */
+    while ((me->tskCnt > tskIdx) &&
+           (*p_tskRunner != (*TKLSDLR_TSK_RUNNER(me->p_tskLst, tskIdx)))) {
+        tskIdx++;
+    }
+
+    assert(me->tskCnt > tskIdx); /* Task runner within task list */
+
+    return (tskIdx);
+}
+
+void TKLsdlr_ctxSetTskActIdx(TKLsdlr_ctx_t* const me,
+                             const uint8_t tskIdx,
+                             const bool active,
+                             const bool updLastRun) {
+    /* Sanity check (Design by Contract) */
+    assert((NULL != me->p_getTick) &&
+           (NULL != me->p_tskLst) &&
+           (me->tskCnt > tskIdx));
+#if TKLSDLRCFG_RELTBL_ENA
+    /* Release times must keep matching release table */
+    assert((NULL == me->p_relTbl) || (false == updLastRun));
+#endif /* TKLSDLRCFG_RELTBL_ENA */
+
+    pv_setTskAct(me,
+                 tskIdx,
+                 active,
+                 updLastRun,
+                 pv_getSetTskActTick(me, updLastRun));
+}
+
+void TKLsdlr_ctxSetTskActMask(TKLsdlr_ctx_t* const me,
+                              const uint32_t tskMask,
+                              const bool active,
+                              const bool updLastRun) {
+    /* Sanity check (Design by Contract) */
+    assert((NULL != me->p_getTick) &&
+           (NULL != me->p_tskLst) &&
+           (0u < me->tskCnt));
+    assert((32u <= me->tskCnt) ||
+           (0u == (tskMask >> me->tskCnt))); /* Tasks within task list */
+#if TKLSDLRCFG_RELTBL_ENA
+    /* Release times must keep matching release table */
+    assert((NULL == me->p_relTbl) || (false == updLastRun));
+#endif /* TKLSDLRCFG_RELTBL_ENA */
+
+    const TKLtyp_tick_t tickCnt = pv_getSetTskActTick(me, updLastRun);
+    uint32_t mask = tskMask;
+
+    /* Set all tasks of mask to "on"/"off" (in task list order) */
+    while (0u != mask) {
+        pv_setTskAct(me, pv_findFirstSet(mask), active, updLastRun, tickCnt);
+        mask &= mask - 1u; /* Clear lowest set bit */
+    }
+}
+
+#if TKLSDLRCFG_EVT_ENA
+void TKLsdlr_ctxPostEvt(TKLsdlr_ctx_t* const me, const uint8_t tskIdx) {
+    /* Sanity check (Design by Contract) */
+    assert((NULL != me->p_tskLst) &&
+           (me->tskCnt > tskIdx) &&
+           (0u == TKLSDLR_TSK_PERIOD(me->p_tskLst, tskIdx)));
+
+    const uint32_t evtBit = EVT_BIT(tskIdx);
+
+    /* Toggle posted bit only if no event is pending already (then, posted and
+       acknowledged bits differ).  Only the posting side writes `evtPost` and
+       only the scheduler writes `evtAck`, so neither needs a critical region,
+       and each bit lives within one byte, so even non-atomic reads of the
+       bitmaps are consistent per bit. */
+    if (0u == ((me->evtPost ^ me->evtAck) & evtBit)) {
+        me->evtPost ^= evtBit;
+    }
+}
+#endif /* TKLSDLRCFG_EVT_ENA */
+
+#if TKLSDLRCFG_TRACE_ENA
+bool TKLsdlr_ctxGetTraceEvt(TKLsdlr_ctx_t* const me,
+                            TKLtyp_traceEvt_t* const p_traceEvt) {
+    /* Sanity check (Design by Contract) */
+    assert(NULL != p_traceEvt);
+
+    const uint8_t tail = me->traceTail;
+    bool isEvt = false;
+
+    if (tail != me->traceHead) { /* Event available? */
+        TKLSDLR_BARRIER(); /* Check for event before reading it */
+        *p_traceEvt = me->traceBuf[tail & (TKLSDLRCFG_TRACE_BUF_LEN - 1u)];
+        TKLSDLR_BARRIER();
+        me->traceTail = (uint8_t)(tail + 1u); /* Release slot after reading */
+        isEvt = true;
+    }
+
+    return (isEvt);
+}
+
+uint8_t TKLsdlr_ctxCntTraceDrop(const TKLsdlr_ctx_t* const me) {
+    return (me->traceDropCnt);
+}
+#endif /* TKLSDLRCFG_TRACE_ENA */
+
+#if TKLSDLRCFG_LOAD_ENA
+uint16_t TKLsdlr_ctxGetCpuLoad(TKLsdlr_ctx_t* const me) {
+    /* Sanity check (Design by Contract) */
+    assert((NULL != me->p_getTick) &&
+           (NULL != me->p_tskLst) &&
+           (0u < me->tskCnt));
+
+    pv_loadAdv(me, (*me->p_getTick)()); /* Account idle time up to now */
+
+    return (pv_loadCalc(me, me->loadBusy));
+}
+
+uint16_t TKLsdlr_ctxGetTskCpuLoad(TKLsdlr_ctx_t* const me,
+                                  const uint8_t tskIdx) {
+    /* Sanity check (Design by Contract) */
+    assert((NULL != me->p_getTick) &&
+           (NULL != me->p_tskLst) &&
+           (me->tskCnt > tskIdx));
+
+    pv_loadAdv(me, (*me->p_getTick)()); /* Account idle time up to now */
+
+    return (pv_loadCalc(me, me->loadTskBusy[tskIdx]));
+}
+#endif /* TKLSDLRCFG_LOAD_ENA */
+
+#if TKLSDLRCFG_OVLD_ENA
+void TKLsdlr_ctxSetTskCrit(TKLsdlr_ctx_t* const me,
+                           const uint8_t tskIdx,
+                           const uint8_t crit) {
+    /* Sanity check (Design by Contract) */
+    assert((NULL != me->p_tskLst) &&
+           (me->tskCnt > tskIdx));
+
+    me->ovldCrit[tskIdx] = crit;
+
+    /* Highest criticality within task list */
+    me->ovldCritMax = 0u;
+    for (uint8_t i = 0u; me->tskCnt > i; i++) {
+        if (me->ovldCrit[i] > me->ovldCritMax) {
+            me->ovldCritMax = me->ovldCrit[i];
+        }
+    }
+
+    if (me->ovldLvl > me->ovldCritMax) { /* Would shed highest criticality? */
+        me->ovldLvl = me->ovldCritMax;
+    }
+}
+
+uint8_t TKLsdlr_ctxGetOvldLvl(const TKLsdlr_ctx_t* const me) {
+    return (me->ovldLvl);
+}
+#endif /* TKLSDLRCFG_OVLD_ENA */
+
+TKLtyp_tick_t TKLsdlr_ctxCntTickToNextRel(TKLsdlr_ctx_t* const me) {
+    /* Sanity check (Design by Contract) */
+    assert((NULL != me->p_getTick) &&
+           (NULL != me->p_tskLst) &&
+           (0u < me->tskCnt));
+
+    const TKLtyp_tick_t tickCnt = (*me->p_getTick)(); /* Get curr. tick count */
+    TKLtyp_tick_t tickToNextRel;
+
+#if TKLSDLRCFG_RELTBL_ENA
+    if (NULL != me->p_relTbl) { /* Release table driven? */
+        tickToNextRel = pv_relTblCntTickToNextRel(me, tickCnt);
+    } else
+#endif /* TKLSDLRCFG_RELTBL_ENA */
+    {
+#if TKLSDLRCFG_PQ_ENA
+        tickToNextRel = pv_pqCntTickToNextRel(me, tickCnt);
+#else
+        tickToNextRel = pv_scanCntTickToNextRel(me, tickCnt);
+#endif /* TKLSDLRCFG_PQ_ENA */
+    }
+
+#if TKLSDLRCFG_EVT_ENA
+    if (EVT_NONE != pv_evtPeek(me)) { /* Event pending? */
+        tickToNextRel = 0u;
+    }
+#endif /* TKLSDLRCFG_EVT_ENA */
+
+    return (tickToNextRel);
+}
+
+void TKLsdlr_ctxExec(TKLsdlr_ctx_t* const me) {
     /* Sanity check (Design by Contract) */
-    assert((NULL != pv_p_getTick) &&
-           (NULL != pv_p_tskLst) &&
-           (0u < pv_tskCnt));
+    assert((NULL != me->p_getTick) &&
+           (NULL != me->p_tskLst) &&
+           (0u < me->tskCnt));
 
-    TKLtyp_tsk_t* const p_tskLst = pv_p_tskLst; /* Set ptr. to task list */
-    const uint8_t tskCnt = pv_tskCnt; /* Number of tasks in task list */
-    const uint32_t tickCnt = (*pv_p_getTick)(); /* Get curr. tick count */
+    const TKLtyp_tick_t tickCnt = (*me->p_getTick)(); /* Get curr. tick count */
+
+#if TKLSDLRCFG_MODE_CHG_ENA
+    pv_modeChg(me, tickCnt); /* Switch task list at start of cycle */
+#endif /* TKLSDLRCFG_MODE_CHG_ENA */
+#if TKLSDLRCFG_LOAD_ENA
+    pv_loadAdv(me, tickCnt);
+#endif /* TKLSDLRCFG_LOAD_ENA */
+#if TKLSDLRCFG_OVLD_ENA
+    pv_ovldAdv(me, tickCnt);
+#endif /* TKLSDLRCFG_OVLD_ENA */
+
+#if TKLSDLRCFG_PQ_ENA
+    const bool isTskRun = pv_pqExec(me, tickCnt);
+#elif TKLSDLRCFG_EDF_ENA
+    const bool isTskRun = pv_edfExec(me, tickCnt);
+#else
+    TKLsdlr_tskLst_t* const p_tskLst = me->p_tskLst; /* Set ptr. to task list */
+    const uint8_t tskCnt = me->tskCnt; /* Number of tasks in task list */
+    bool isTskRun = false;
 
     /* Loop through all tasks in task list.
        During one full loop ("cycle"):
@@ -117,32 +2362,390 @@ void TKLsdlr_exec(void) {
        * Ignore disabled tasks (but still update `lastRun` time)
        * Check for task deadline overrun and keep count
        * If a task was run, end cycle */
+#if TKLSDLRCFG_EVT_ENA
+    /* Sporadic tasks are only run on a pending event, the highest priority
+       one of which is found without scan */
+    const uint8_t evtTsk = pv_evtPeek(me);
+#endif /* TKLSDLRCFG_EVT_ENA */
+#if TKLSDLRCFG_ACT_MAP_ENA
+    /* Bring `lastRun` times of disabled tasks up to date once per half tick
+       count range */
+    if (0u != ((tickCnt ^ me->actTick) & ACT_TICK_MSB)) {
+        pv_actSync(me, tickCnt);
+    }
+    me->actTick = tickCnt;
+
+    /* Skip disabled tasks (their `lastRun` time is updated lazily, on
+       re-activation) */
+    for (uint8_t i = pv_actNext(me, 0u);
+         i < tskCnt;
+         i = pv_actNext(me, i + 1u)) {
+#elif TKLSDLRCFG_DM_ORDER_ENA
+    for (uint8_t prio = 0u; prio < tskCnt; prio++) {
+        const uint8_t i = me->dispOrder[prio]; /* In dispatch order */
+
+#else
     for (uint8_t i = 0u; i < tskCnt; i++) {
+#endif /* TKLSDLRCFG_ACT_MAP_ENA */
+#if TKLSDLRCFG_EVT_ENA
+        if (evtTsk == i) { /* Pending event? */
+            isTskRun = pv_evtRel(me, i, tickCnt);
+            if (true == isTskRun) {
+                break; /* End cycle */
+            }
+        } else if (0u == TKLSDLR_TSK_PERIOD(p_tskLst, i)) { /* Sporadic task? */
+            /* Do nothing (no pending event) */
+        } else
+#endif /* TKLSDLRCFG_EVT_ENA */
         /* Check if new execution period for task has started
            (still correct on tick count rollover) */
-        if (tickCnt - p_tskLst[i].lastRun >= p_tskLst[i].period) {
+        if ((TKLtyp_tick_t)(tickCnt - TKLSDLR_TSK_LAST_RUN(p_tskLst, i)) >=
+            TKLSDLR_TSK_PERIOD(p_tskLst, i)) {
             /* Save (ideal) time of when task was "ready-to-run" */
-            p_tskLst[i].lastRun =
-                tickCnt - ((tickCnt - p_tskLst[i].lastRun) % p_tskLst[i].period);
-
-            if (true == p_tskLst[i].active) { /* Task enabled? */
-                (*p_tskLst[i].p_tskRunner)(); /* Run periodic task */
-
-                /* Check for task deadline overrun (still correct on time tick
-                   rollover) */
-                if ((*pv_p_getTick)() - p_tskLst[i].lastRun >
-                    p_tskLst[i].deadline) {
-                    if (UINT8_MAX > pv_tskOverrunCnt) { /* Counter unsaturated? */
-                        pv_tskOverrunCnt++; /* Incr. deadline overrun counter */
-                    }
-
-                    /* Run custom deadline overrun hook, if defined */
-                    TKLSDLRCFG_OVERRUN_HOOK(p_tskLst[i].p_tskRunner);
-                }
+            TKLSDLR_TSK_LAST_RUN(p_tskLst, i) = pv_calcRel(me, i, tickCnt);
+
+            if (true == pv_isTskRunnable(me, i)) { /* Task enabled? */
+                pv_runTsk(me, i, tickCnt);
+                isTskRun = true;
 
                 break; /* End cycle to allow starting new one as soon as
                           possible (gives better schedulability) */
             }
         } /* if (...) */
     } /* for (...) */
+
+#if TKLSDLRCFG_ACT_MAP_ENA
+    if (false == isTskRun) { /* Whole task list reached? */
+        pv_actReach(me, (uint8_t)(tskCnt - 1u), tickCnt);
+    }
+#endif /* TKLSDLRCFG_ACT_MAP_ENA */
+#endif /* TKLSDLRCFG_PQ_ENA */
+
+#if TKLSDLRCFG_CHAIN_ENA
+    if (CHAIN_NONE != me->chainCur) { /* Head of chain run? */
+        pv_chainExec(me); /* Run its consumers back-to-back */
+    }
+#endif /* TKLSDLRCFG_CHAIN_ENA */
+
+    pv_idle(me, isTskRun);
+}
+
+#if TKLSDLRCFG_RELTBL_ENA
+void TKLsdlr_ctxSetRelTbl(TKLsdlr_ctx_t* const me,
+                          const TKLtyp_relTbl_t* const p_relTbl) {
+    /* Sanity check (Design by Contract) */
+    assert((NULL != p_relTbl) &&
+           (NULL != me->p_tskLst) &&
+           (me->tskCnt == p_relTbl->tskCnt) &&
+           (32u >= p_relTbl->tskCnt) &&
+           (0u < p_relTbl->hyperperiod) &&
+           ((TKLTYP_TICK_MAX / 2u) >= p_relTbl->hyperperiod) &&
+           (0u < p_relTbl->slotCnt));
+    for (uint8_t i = 0u; p_relTbl->tskCnt > i; i++) {
+        /* Same period and first release (offset) as in task list */
+        assert((p_relTbl->p_period[i] == TKLSDLR_TSK_PERIOD(me->p_tskLst, i)) &&
+               (p_relTbl->p_offset[i] ==
+                (TKLtyp_tick_t)(TKLSDLR_TSK_LAST_RUN(me->p_tskLst, i) +
+                                TKLSDLR_TSK_PERIOD(me->p_tskLst, i))));
+    }
+
+    me->relTblBase = 0u;
+    me->relTblIdx = 0u;
+    me->relTblRdyMask = 0u;
+    me->p_relTbl = p_relTbl;
+}
+
+void TKLsdlr_ctxExecTbl(TKLsdlr_ctx_t* const me) {
+    /* Sanity check (Design by Contract) */
+    assert((NULL != me->p_getTick) &&
+           (NULL != me->p_tskLst) &&
+           (0u < me->tskCnt) &&
+           (NULL != me->p_relTbl));
+
+    const TKLtyp_tick_t tickCnt = (*me->p_getTick)(); /* Get curr. tick count */
+    bool isTskRun = false;
+
+#if TKLSDLRCFG_LOAD_ENA
+    pv_loadAdv(me, tickCnt);
+#endif /* TKLSDLRCFG_LOAD_ENA */
+#if TKLSDLRCFG_OVLD_ENA
+    pv_ovldAdv(me, tickCnt);
+#endif /* TKLSDLRCFG_OVLD_ENA */
+    pv_relTblRelUpTo(me, tickCnt);
+
+    /* Handle released tasks in task list order (priority).
+       Ignore disabled tasks.  If a task was run, end cycle. */
+    while (0u != me->relTblRdyMask) {
+        const uint8_t tsk = pv_findFirstSet(me->relTblRdyMask);
+
+        me->relTblRdyMask &= me->relTblRdyMask - 1u; /* Clear lowest set bit */
+
+        if (true == pv_isTskRunnable(me, tsk)) { /* Task enabled? */
+            pv_runTsk(me, tsk, tickCnt);
+            isTskRun = true;
+
+            break; /* End cycle to allow starting new one as soon as
+                      possible (gives better schedulability) */
+        }
+    } /* while (...) */
+
+#if TKLSDLRCFG_CHAIN_ENA
+    if (CHAIN_NONE != me->chainCur) { /* Head of chain run? */
+        pv_chainExec(me); /* Run its consumers back-to-back */
+    }
+#endif /* TKLSDLRCFG_CHAIN_ENA */
+
+    pv_idle(me, isTskRun);
+}
+#endif /* TKLSDLRCFG_RELTBL_ENA */
+
+#if TKLSDLRCFG_CHAIN_ENA
+void TKLsdlr_ctxSetChainTbl(TKLsdlr_ctx_t* const me,
+                            const TKLtyp_chainTbl_t* const p_chainTbl) {
+    /* Sanity check (Design by Contract) */
+    assert((NULL != p_chainTbl) &&
+           (NULL != me->p_tskLst) &&
+           (me->tskCnt == p_chainTbl->tskCnt) &&
+           (32u >= p_chainTbl->tskCnt) &&
+           (0u < p_chainTbl->chainCnt) &&
+           (p_chainTbl->tskCnt >= p_chainTbl->chainCnt));
+
+    const uint8_t tskCnt = p_chainTbl->tskCnt;
+    uint32_t chainMask = 0u; /* Tasks within any chain */
+
+    /* Producers of each task */
+    for (uint8_t i = 0u; tskCnt > i; i++) {
+        me->chainProdMask[i] = 0u;
+        me->chainOfHead[i] = CHAIN_NONE;
+    }
+    for (uint8_t i = 0u; tskCnt > i; i++) {
+        uint32_t consMask = p_chainTbl->p_cons[i];
+
+        /* Consumers within task list */
+        assert((32u == tskCnt) || (0u == (consMask >> tskCnt)));
+        while (0u != consMask) {
+            const uint8_t tsk = pv_findFirstSet(consMask);
+
+            /* Consumers are sporadic tasks */
+            assert(0u == TKLSDLR_TSK_PERIOD(me->p_tskLst, tsk));
+            consMask &= consMask - 1u; /* Clear lowest set bit */
+            me->chainProdMask[tsk] |= (uint32_t)1u << i;
+        }
+    }
+
+    for (uint8_t c = 0u; p_chainTbl->chainCnt > c; c++) {
+        const uint8_t headTsk = p_chainTbl->p_chain[c].headTsk;
+        uint32_t memberMask = (uint32_t)1u << headTsk;
+        uint32_t finMask = 0u;
+        uint32_t rdyMask = memberMask;
+
+        /* Head is no consumer and heads only one chain */
+        assert((tskCnt > headTsk) &&
+               (0u == me->chainProdMask[headTsk]) &&
+               (CHAIN_NONE == me->chainOfHead[headTsk]) &&
+               (0u < p_chainTbl->p_chain[c].deadline));
+        me->chainOfHead[headTsk] = c;
+        me->chainLatMax[c] = 0u;
+
+        /* Walk chain in topological order (cyclic chains never finish all
+           their tasks) */
+        while (0u != rdyMask) {
+            const uint8_t tsk = pv_findFirstSet(rdyMask);
+            uint32_t consMask = p_chainTbl->p_cons[tsk];
+
+            rdyMask &= rdyMask - 1u; /* Clear lowest set bit */
+            finMask |= (uint32_t)1u << tsk;
+            memberMask |= consMask;
+            while (0u != consMask) {
+                const uint8_t cons = pv_findFirstSet(consMask);
+
+                consMask &= consMask - 1u; /* Clear lowest set bit */
+                if (0u == (me->chainProdMask[cons] & ~finMask)) {
+                    rdyMask |= (uint32_t)1u << cons;
+                }
+            }
+        }
+
+        /* Acyclic, and no task within several chains */
+        assert((finMask == memberMask) && (0u == (chainMask & memberMask)));
+        chainMask |= memberMask;
+    }
+
+    me->chainCur = CHAIN_NONE;
+    me->chainOverrunCnt = 0u;
+    me->p_chainTbl = p_chainTbl;
+}
+
+TKLtyp_tick_t TKLsdlr_ctxGetChainLat(const TKLsdlr_ctx_t* const me,
+                                     const uint8_t chainIdx) {
+    /* Sanity check (Design by Contract) */
+    assert((NULL != me->p_chainTbl) &&
+           (me->p_chainTbl->chainCnt > chainIdx));
+
+    return (me->chainLatMax[chainIdx]);
+}
+
+uint8_t TKLsdlr_ctxCntChainOverrun(const TKLsdlr_ctx_t* const me) {
+    return (me->chainOverrunCnt);
+}
+#endif /* TKLSDLRCFG_CHAIN_ENA */
+
+void TKLsdlr_setTickSrc(const TKLtyp_p_getTick_t p_getTick) {
+    TKLsdlr_ctxSetTickSrc(&pv_ctx, p_getTick);
+}
+
+#if TKLSDLRCFG_TS_ENA
+void TKLsdlr_setTsSrc(const TKLtyp_p_getTs_t p_getTs) {
+    TKLsdlr_ctxSetTsSrc(&pv_ctx, p_getTs);
+}
+#endif /* TKLSDLRCFG_TS_ENA */
+
+void TKLsdlr_setTskLst(TKLsdlr_tskLst_t* const p_tskLst, const uint8_t tskCnt) {
+    TKLsdlr_ctxSetTskLst(&pv_ctx, p_tskLst, tskCnt);
+}
+
+#if TKLSDLRCFG_MODE_CHG_ENA
+bool TKLsdlr_reqTskLst(TKLsdlr_tskLst_t* const p_tskLst,
+                       const uint8_t tskCnt,
+                       const TKLtyp_tick_t hyperperiod) {
+    return (TKLsdlr_ctxReqTskLst(&pv_ctx, p_tskLst, tskCnt, hyperperiod));
+}
+#endif /* TKLSDLRCFG_MODE_CHG_ENA */
+
+TKLsdlr_tskLst_t* TKLsdlr_getTskLst(void) {
+    return (TKLsdlr_ctxGetTskLst(&pv_ctx));
+}
+
+uint8_t TKLsdlr_cntTsk(void) {
+    return (TKLsdlr_ctxCntTsk(&pv_ctx));
+}
+
+#if TKLSDLRCFG_DM_ORDER_ENA
+uint8_t TKLsdlr_cntTskMisorder(void) {
+    return (TKLsdlr_ctxCntTskMisorder(&pv_ctx));
+}
+
+uint8_t TKLsdlr_getDispTsk(const uint8_t prio) {
+    return (TKLsdlr_ctxGetDispTsk(&pv_ctx, prio));
+}
+#endif /* TKLSDLRCFG_DM_ORDER_ENA */
+
+uint8_t TKLsdlr_cntTskOverrun(void) {
+    return (TKLsdlr_ctxCntTskOverrun(&pv_ctx));
+}
+
+void TKLsdlr_clrTskOverrun(void) {
+    TKLsdlr_ctxClrTskOverrun(&pv_ctx);
+}
+
+#if TKLSDLRCFG_TSK_OVERRUN_ENA
+void TKLsdlr_getTskOverrun(const uint8_t tskIdx,
+                           TKLtyp_tskOverrun_t* const p_tskOverrun) {
+    TKLsdlr_ctxGetTskOverrun(&pv_ctx, tskIdx, p_tskOverrun);
+}
+
+uint8_t TKLsdlr_getLastOverrunTsk(void) {
+    return (TKLsdlr_ctxGetLastOverrunTsk(&pv_ctx));
+}
+#endif /* TKLSDLRCFG_TSK_OVERRUN_ENA */
+
+#if TKLSDLRCFG_STAT_ENA
+void TKLsdlr_getTskStat(const uint8_t tskIdx,
+                        TKLtyp_tskStat_t* const p_tskStat) {
+    TKLsdlr_ctxGetTskStat(&pv_ctx, tskIdx, p_tskStat);
+}
+
+void TKLsdlr_clrTskStat(void) {
+    TKLsdlr_ctxClrTskStat(&pv_ctx);
+}
+#endif /* TKLSDLRCFG_STAT_ENA */
+
+void TKLsdlr_setTskAct(const TKLtyp_p_tskRunner_t p_tskRunner,
+                       const bool active,
+                       const bool updLastRun) {
+    TKLsdlr_ctxSetTskAct(&pv_ctx, p_tskRunner, active, updLastRun);
+}
+
+uint8_t TKLsdlr_getTskIdx(const TKLtyp_p_tskRunner_t p_tskRunner) {
+    return (TKLsdlr_ctxGetTskIdx(&pv_ctx, p_tskRunner));
+}
+
+void TKLsdlr_setTskActIdx(const uint8_t tskIdx,
+                          const bool active,
+                          const bool updLastRun) {
+    TKLsdlr_ctxSetTskActIdx(&pv_ctx, tskIdx, active, updLastRun);
+}
+
+void TKLsdlr_setTskActMask(const uint32_t tskMask,
+                           const bool active,
+                           const bool updLastRun) {
+    TKLsdlr_ctxSetTskActMask(&pv_ctx, tskMask, active, updLastRun);
+}
+
+#if TKLSDLRCFG_EVT_ENA
+void TKLsdlr_postEvt(const uint8_t tskIdx) {
+    TKLsdlr_ctxPostEvt(&pv_ctx, tskIdx);
+}
+#endif /* TKLSDLRCFG_EVT_ENA */
+
+#if TKLSDLRCFG_TRACE_ENA
+bool TKLsdlr_getTraceEvt(TKLtyp_traceEvt_t* const p_traceEvt) {
+    return (TKLsdlr_ctxGetTraceEvt(&pv_ctx, p_traceEvt));
+}
+
+uint8_t TKLsdlr_cntTraceDrop(void) {
+    return (TKLsdlr_ctxCntTraceDrop(&pv_ctx));
+}
+#endif /* TKLSDLRCFG_TRACE_ENA */
+
+#if TKLSDLRCFG_LOAD_ENA
+uint16_t TKLsdlr_getCpuLoad(void) {
+    return (TKLsdlr_ctxGetCpuLoad(&pv_ctx));
+}
+
+uint16_t TKLsdlr_getTskCpuLoad(const uint8_t tskIdx) {
+    return (TKLsdlr_ctxGetTskCpuLoad(&pv_ctx, tskIdx));
+}
+#endif /* TKLSDLRCFG_LOAD_ENA */
+
+#if TKLSDLRCFG_OVLD_ENA
+void TKLsdlr_setTskCrit(const uint8_t tskIdx, const uint8_t crit) {
+    TKLsdlr_ctxSetTskCrit(&pv_ctx, tskIdx, crit);
+}
+
+uint8_t TKLsdlr_getOvldLvl(void) {
+    return (TKLsdlr_ctxGetOvldLvl(&pv_ctx));
+}
+#endif /* TKLSDLRCFG_OVLD_ENA */
+
+TKLtyp_tick_t TKLsdlr_cntTickToNextRel(void) {
+    return (TKLsdlr_ctxCntTickToNextRel(&pv_ctx));
+}
+
+void TKLsdlr_exec(void) {
+    TKLsdlr_ctxExec(&pv_ctx);
+}
+
+#if TKLSDLRCFG_CHAIN_ENA
+void TKLsdlr_setChainTbl(const TKLtyp_chainTbl_t* const p_chainTbl) {
+    TKLsdlr_ctxSetChainTbl(&pv_ctx, p_chainTbl);
+}
+
+TKLtyp_tick_t TKLsdlr_getChainLat(const uint8_t chainIdx) {
+    return (TKLsdlr_ctxGetChainLat(&pv_ctx, chainIdx));
+}
+
+uint8_t TKLsdlr_cntChainOverrun(void) {
+    return (TKLsdlr_ctxCntChainOverrun(&pv_ctx));
+}
+#endif /* TKLSDLRCFG_CHAIN_ENA */
+
+#if TKLSDLRCFG_RELTBL_ENA
+void TKLsdlr_setRelTbl(const TKLtyp_relTbl_t* const p_relTbl) {
+    TKLsdlr_ctxSetRelTbl(&pv_ctx, p_relTbl);
+}
+
+void TKLsdlr_execTbl(void) {
+    TKLsdlr_ctxExecTbl(&pv_ctx);
 }
+#endif /* TKLSDLRCFG_RELTBL_ENA */
@@ -8,13 +8,468 @@
 #include "stdint.h"
 #include "stddef.h"
 #include "stdbool.h"
+#include "string.h"
 #include "assert.h" /* For sanity checks (Design by Contract) */
 
 #include "TKLtyp.h"
 #include "TKLsdlrCfg.h"
 
 /** \brief Relative system time tick query function signature */
-typedef uint32_t (* TKLtyp_p_getTick_t)(void);
+typedef TKLtyp_tick_t (* TKLtyp_p_getTick_t)(void);
+
+#if TKLSDLRCFG_TS_ENA
+/** \brief High-resolution time stamp query function signature */
+typedef uint32_t (* TKLtyp_p_getTs_t)(void);
+#endif /* TKLSDLRCFG_TS_ENA */
+
+/* ATTRIBUTES
+ * ==========
+ */
+
+#if TKLSDLRCFG_STAT_ENA
+/** \brief Accumulated execution statistics of a task (private) */
+typedef struct {
+    /** \brief Number of task runs (saturating) */
+    uint32_t runCnt;
+    /** \brief Min. execution time */
+    TKLtyp_tick_t execMin;
+    /** \brief Max. execution time */
+    TKLtyp_tick_t execMax;
+    /** \brief Sum of execution times (for mean) */
+    uint64_t execSum;
+    /** \brief Min. response time */
+    TKLtyp_tick_t respMin;
+    /** \brief Max. response time */
+    TKLtyp_tick_t respMax;
+    /** \brief Sum of response times (for mean) */
+    uint64_t respSum;
+    /** \brief Min. start delay (for jitter) */
+    TKLtyp_tick_t startDlyMin;
+    /** \brief Max. start delay (for jitter) */
+    TKLtyp_tick_t startDlyMax;
+#if TKLSDLRCFG_TS_ENA
+    /** \brief Min. execution time in time stamp units */
+    uint32_t execTsMin;
+    /** \brief Max. execution time in time stamp units */
+    uint32_t execTsMax;
+    /** \brief Sum of execution times in time stamp units (for mean) */
+    uint64_t execTsSum;
+#endif /* TKLSDLRCFG_TS_ENA */
+} TKLsdlr_statAcc_t;
+#endif /* TKLSDLRCFG_STAT_ENA */
+
+#if TKLSDLRCFG_TSK_OVERRUN_ENA
+#if 8 == TKLSDLRCFG_TSK_OVERRUN_CNT_WIDTH
+/** \brief Per-task deadline overrun counter type (private) */
+typedef uint8_t TKLsdlr_overrunCnt_t;
+#elif 16 == TKLSDLRCFG_TSK_OVERRUN_CNT_WIDTH
+typedef uint16_t TKLsdlr_overrunCnt_t;
+#elif 32 == TKLSDLRCFG_TSK_OVERRUN_CNT_WIDTH
+typedef uint32_t TKLsdlr_overrunCnt_t;
+#else
+#error "TKLSDLRCFG_TSK_OVERRUN_CNT_WIDTH must be 8, 16 or 32"
+#endif /* TKLSDLRCFG_TSK_OVERRUN_CNT_WIDTH */
+#endif /* TKLSDLRCFG_TSK_OVERRUN_ENA */
+
+#if TKLSDLRCFG_TRACE_ENA
+#if (2u > TKLSDLRCFG_TRACE_BUF_LEN) || (128u < TKLSDLRCFG_TRACE_BUF_LEN) || \
+    (0u != (TKLSDLRCFG_TRACE_BUF_LEN & (TKLSDLRCFG_TRACE_BUF_LEN - 1u)))
+#error "TKLSDLRCFG_TRACE_BUF_LEN must be a power of 2 in range [2, 128]"
+#endif /* TKLSDLRCFG_TRACE_BUF_LEN */
+#endif /* TKLSDLRCFG_TRACE_ENA */
+
+#if TKLSDLRCFG_LOAD_ENA
+#if (0u != (TKLSDLRCFG_LOAD_WIN % TKLSDLRCFG_LOAD_SUBWIN_CNT)) || \
+    (1u > TKLSDLRCFG_LOAD_SUBWIN_CNT) || (254u < TKLSDLRCFG_LOAD_SUBWIN_CNT)
+#error "TKLSDLRCFG_LOAD_SUBWIN_CNT must divide TKLSDLRCFG_LOAD_WIN"
+#endif /* TKLSDLRCFG_LOAD_SUBWIN_CNT */
+#endif /* TKLSDLRCFG_LOAD_ENA */
+
+#if TKLSDLRCFG_REL_RECIP_ENA && (64 == TKLSDLRCFG_TICK_WIDTH)
+#error "TKLSDLRCFG_REL_RECIP_ENA requires a time tick width of 16 or 32 bits"
+#endif /* TKLSDLRCFG_REL_RECIP_ENA && ... */
+
+#if TKLSDLRCFG_ACT_MAP_ENA && (TKLSDLRCFG_PQ_ENA || TKLSDLRCFG_RELTBL_ENA)
+#error "TKLSDLRCFG_ACT_MAP_ENA requires task list scan without release table"
+#endif /* TKLSDLRCFG_ACT_MAP_ENA && ... */
+
+#if TKLSDLRCFG_DM_ORDER_ENA && (TKLSDLRCFG_EDF_ENA || TKLSDLRCFG_ACT_MAP_ENA)
+#error "TKLSDLRCFG_DM_ORDER_ENA excludes EDF and active task bitmap"
+#endif /* TKLSDLRCFG_DM_ORDER_ENA && ... */
+
+#if TKLSDLRCFG_CHAIN_ENA && (!TKLSDLRCFG_EVT_ENA || TKLSDLRCFG_ACT_MAP_ENA)
+#error "TKLSDLRCFG_CHAIN_ENA requires events and excludes active task bitmap"
+#endif /* TKLSDLRCFG_CHAIN_ENA && ... */
+
+#if TKLSDLRCFG_OVLD_ENA
+#if (1u > TKLSDLRCFG_OVLD_OVERRUN_MAX) || \
+    (255u < TKLSDLRCFG_OVLD_OVERRUN_MAX) || \
+    (255u < TKLSDLRCFG_OVLD_STRETCH) || (1u > TKLSDLRCFG_OVLD_WIN)
+#error "TKLSDLRCFG_OVLD_* out of range"
+#endif /* TKLSDLRCFG_OVLD_OVERRUN_MAX ... */
+#endif /* TKLSDLRCFG_OVLD_ENA */
+
+/**
+ * \brief Compiler memory barrier
+ *
+ * Keeps the compiler from moving memory accesses across it (e.g., when
+ * inlining or with link-time optimization), so that lock-free ring buffers
+ * fill or read a slot entirely before publishing or releasing it via their
+ * (`volatile`) indices.  This is a compiler-only guarantee that suffices
+ * between main loop and ISRs on a single core.  It is no CPU memory fence and
+ * thus not safe across cores or threads.  Can be defined in `TKLsdlrCfg.h` for
+ * compilers without GNU-style inline assembly.
+ */
+#ifndef TKLSDLR_BARRIER
+#if defined(__GNUC__)
+#define TKLSDLR_BARRIER() __asm__ volatile ("" ::: "memory")
+#else
+#error "TKLSDLR_BARRIER() must be defined for this compiler"
+#endif /* __GNUC__ */
+#endif /* TKLSDLR_BARRIER */
+
+#if TKLSDLRCFG_TSK_SOA_ENA
+/**
+ * \brief Task list (as registered with the scheduler)
+ *
+ * Structure-of-arrays layout (see \ref TKLSDLRCFG_TSK_SOA_ENA).
+ */
+typedef TKLtyp_tskLstSoa_t TKLsdlr_tskLst_t;
+
+/**
+ * \{
+ * \brief Access member of task with index `tsk_` within task list
+ * `p_tskLst_` (lvalue; independent of task list layout)
+ */
+#define TKLSDLR_TSK_ACTIVE(p_tskLst_, tsk_) ((p_tskLst_)->p_active[tsk_])
+#define TKLSDLR_TSK_PERIOD(p_tskLst_, tsk_) ((p_tskLst_)->p_hot[tsk_].period)
+#define TKLSDLR_TSK_DEADLINE(p_tskLst_, tsk_) \
+    ((p_tskLst_)->p_cold[tsk_].deadline)
+#define TKLSDLR_TSK_LAST_RUN(p_tskLst_, tsk_) \
+    ((p_tskLst_)->p_hot[tsk_].lastRun)
+#define TKLSDLR_TSK_RUNNER(p_tskLst_, tsk_) \
+    ((p_tskLst_)->p_cold[tsk_].p_tskRunner)
+/** \} */
+
+/**
+ * \brief Define a task list (independent of task list layout)
+ *
+ * `lst_` is an "X macro" that lists the tasks in order of priority, each as
+ * `X_(active, period, deadline, lastRun, p_tskRunner)`, i.e. with the
+ * members in the same order as in a \ref TKLtyp_tsk_t initializer.  E.g.:
+ *
+ *     #define APP_TSK_LST(X_) \
+ *         X_(true, 10u, 2u, 0u, &APP_tskA) \
+ *         X_(true, 100u, 5u, TKLTYP_CALC_OFFSET(100u, 50u), &APP_tskB)
+ *
+ *     TKLSDLR_TSK_LST_DEF(static, pv_tskLst, APP_TSK_LST);
+ *
+ *     TKLsdlr_setTskLst(TKLSDLR_TSK_LST(pv_tskLst),
+ *                       TKLSDLR_TSK_LST_CNT(pv_tskLst));
+ *
+ * `sc_` is the storage class specifier of the definition(s) (may be empty).
+ * Defines the hot, activation status and (`const`) cold arrays
+ * `<name_>Hot`, `<name_>Active` and `<name_>Cold`, and the task list
+ * `name_` referencing them.
+ */
+#define TKLSDLR_TSK_LST_DEF(sc_, name_, lst_) \
+    sc_ TKLtyp_tskHot_t name_##Hot[] = {lst_(TKLSDLR_TSK_LST_HOT)}; \
+    sc_ volatile bool name_##Active[] = {lst_(TKLSDLR_TSK_LST_ACTIVE)}; \
+    sc_ const TKLtyp_tskCold_t name_##Cold[] = {lst_(TKLSDLR_TSK_LST_COLD)}; \
+    sc_ TKLsdlr_tskLst_t name_ = {name_##Hot, name_##Active, name_##Cold}
+
+/** \brief Pointer to task list defined via \ref TKLSDLR_TSK_LST_DEF() */
+#define TKLSDLR_TSK_LST(name_) (&(name_))
+
+/**
+ * \brief Number of tasks within task list defined via
+ * \ref TKLSDLR_TSK_LST_DEF()
+ */
+#define TKLSDLR_TSK_LST_CNT(name_) \
+    ((uint8_t)(sizeof(name_##Hot) / sizeof(name_##Hot[0])))
+
+/**
+ * \{
+ * \brief Task list entry expansions of \ref TKLSDLR_TSK_LST_DEF() (private)
+ */
+#define TKLSDLR_TSK_LST_HOT(active_, period_, deadline_, lastRun_, \
+                            p_tskRunner_) \
+    {(period_), (lastRun_)},
+#define TKLSDLR_TSK_LST_ACTIVE(active_, period_, deadline_, lastRun_, \
+                               p_tskRunner_) \
+    (active_),
+#define TKLSDLR_TSK_LST_COLD(active_, period_, deadline_, lastRun_, \
+                             p_tskRunner_) \
+    {(deadline_), (p_tskRunner_)},
+/** \} */
+#else
+/** \brief Task list (as registered with the scheduler; array of tasks) */
+typedef TKLtyp_tsk_t TKLsdlr_tskLst_t;
+
+#define TKLSDLR_TSK_ACTIVE(p_tskLst_, tsk_) ((p_tskLst_)[tsk_].active)
+#define TKLSDLR_TSK_PERIOD(p_tskLst_, tsk_) ((p_tskLst_)[tsk_].period)
+#define TKLSDLR_TSK_DEADLINE(p_tskLst_, tsk_) ((p_tskLst_)[tsk_].deadline)
+#define TKLSDLR_TSK_LAST_RUN(p_tskLst_, tsk_) ((p_tskLst_)[tsk_].lastRun)
+#define TKLSDLR_TSK_RUNNER(p_tskLst_, tsk_) ((p_tskLst_)[tsk_].p_tskRunner)
+
+#define TKLSDLR_TSK_LST_DEF(sc_, name_, lst_) \
+    sc_ TKLtyp_tsk_t name_[] = {lst_(TKLSDLR_TSK_LST_AOS)}
+
+#define TKLSDLR_TSK_LST(name_) (name_)
+
+#define TKLSDLR_TSK_LST_CNT(name_) \
+    ((uint8_t)(sizeof(name_) / sizeof(name_[0])))
+
+#define TKLSDLR_TSK_LST_AOS(active_, period_, deadline_, lastRun_, \
+                            p_tskRunner_) \
+    {(active_), (period_), (deadline_), (lastRun_), (p_tskRunner_)},
+#endif /* TKLSDLRCFG_TSK_SOA_ENA */
+
+/**
+ * \brief Scheduler instance (context)
+ *
+ * Holds the complete state of one scheduler, so that several independent
+ * schedulers can be run, e.g. one per core/thread, or a high rate one within
+ * a timer ISR besides the one within the main endless "super loop".
+ * Members are private, i.e. must only be accessed via the `TKLsdlr_ctx<Op>()`
+ * functions.  An instance must only be used from one context at a time
+ * (except for the lock-free trace ring buffer consumer).
+ *
+ * An instance must be initialized via \ref TKLsdlr_ctxInit() (or be zero
+ * initialized, e.g. by static storage duration) before first use.
+ */
+typedef struct {
+    /** \brief Pointer to function that provides curr. rel. sys. time tick */
+    TKLtyp_p_getTick_t p_getTick;
+#if TKLSDLRCFG_TS_ENA
+    /** \brief Pointer to function that provides curr. high-res. time stamp */
+    TKLtyp_p_getTs_t p_getTs;
+#endif /* TKLSDLRCFG_TS_ENA */
+    /** \brief Registered task list */
+    TKLsdlr_tskLst_t* volatile p_tskLst;
+    /** \brief Number of tasks within registered task list */
+    volatile uint8_t tskCnt;
+    /** \brief Task deadline overrun counter */
+    volatile uint8_t tskOverrunCnt;
+#if TKLSDLRCFG_PQ_ENA
+    /**
+     * \brief Release heap
+     *
+     * Binary min-heap of task indices, ordered by next release tick
+     * (`lastRun + period`) of the respective tasks.
+     */
+    uint8_t pqRelHeap[TKLSDLRCFG_TSK_CNT_MAX];
+    /** \brief Number of tasks within release heap */
+    uint8_t pqRelCnt;
+    /**
+     * \brief Position of each task within release heap
+     *
+     * `UINT8_MAX` if task is within ready heap instead.
+     */
+    uint8_t pqRelPos[TKLSDLRCFG_TSK_CNT_MAX];
+    /**
+     * \brief Ready heap
+     *
+     * Binary min-heap of indices of released (due-to-run) tasks, ordered by
+     * task index (i.e., priority within task list), or by absolute deadline
+     * with EDF scheduling policy.
+     */
+    uint8_t pqRdyHeap[TKLSDLRCFG_TSK_CNT_MAX];
+    /** \brief Number of tasks within ready heap */
+    uint8_t pqRdyCnt;
+#if TKLSDLRCFG_EDF_ENA
+    /**
+     * \brief Absolute deadline of each task within ready heap
+     *
+     * Fixed when the task enters the ready heap, so that the heap order
+     * remains intact.
+     */
+    TKLtyp_tick_t pqRdyDl[TKLSDLRCFG_TSK_CNT_MAX];
+#endif /* TKLSDLRCFG_EDF_ENA */
+#endif /* TKLSDLRCFG_PQ_ENA */
+#if TKLSDLRCFG_DM_ORDER_ENA
+    /**
+     * \brief Dispatch order
+     *
+     * Indices of tasks within task list, sorted by deadline (stable).
+     */
+    uint8_t dispOrder[TKLSDLRCFG_TSK_CNT_MAX];
+    /** \brief Position of each task within dispatch order (priority) */
+    uint8_t dispPrio[TKLSDLRCFG_TSK_CNT_MAX];
+    /** \brief Number of tasks whose dispatch order differs from task list */
+    uint8_t dispMisorderCnt;
+#endif /* TKLSDLRCFG_DM_ORDER_ENA */
+#if TKLSDLRCFG_MODE_CHG_ENA
+    /**
+     * \brief Requested task list (second buffer besides registered task list)
+     *
+     * Written by requesting side only, and only while no request is pending.
+     */
+    TKLsdlr_tskLst_t* volatile p_reqTskLst;
+    /** \brief Number of tasks within requested task list */
+    volatile uint8_t reqTskCnt;
+    /** \brief Hyperperiod to switch at a boundary of (`0` for any cycle) */
+    volatile TKLtyp_tick_t reqHyperperiod;
+    /**
+     * \brief Mode change requested flag (toggled by requesting side only)
+     *
+     * A request is pending while requested and acknowledged flag differ.
+     */
+    volatile bool modeChgReq;
+    /** \brief Mode change acknowledged flag (toggled by scheduler only) */
+    volatile bool modeChgAck;
+    /** \brief Whether time of pending mode change is known yet */
+    bool isModeChgTick;
+    /** \brief Time of pending mode change */
+    TKLtyp_tick_t modeChgTick;
+    /** \brief Time tick count of previous cycle (to detect its rollover) */
+    TKLtyp_tick_t modeChgTickPrev;
+    /**
+     * \brief Number of time tick count rollovers since time tick count `0`
+     * (for hyperperiod boundaries)
+     */
+    uint32_t modeChgWrapCnt;
+#endif /* TKLSDLRCFG_MODE_CHG_ENA */
+#if TKLSDLRCFG_RELTBL_ENA
+    /** \brief Registered release table */
+    const TKLtyp_relTbl_t* p_relTbl;
+    /** \brief Time of begin of current hyperperiod */
+    TKLtyp_tick_t relTblBase;
+    /** \brief Index of next (not yet reached) release slot in hyperperiod */
+    uint32_t relTblIdx;
+    /**
+     * \brief Released (due-to-run) tasks
+     *
+     * Bit `i` set means task with index `i` within task list is due to run.
+     */
+    uint32_t relTblRdyMask;
+#endif /* TKLSDLRCFG_RELTBL_ENA */
+#if TKLSDLRCFG_CHAIN_ENA
+    /** \brief Registered task chains */
+    const TKLtyp_chainTbl_t* p_chainTbl;
+    /** \brief Producers of each task (bit `i` is task `i`) */
+    uint32_t chainProdMask[32];
+    /** \brief Chain each task is head of (`UINT8_MAX` if none) */
+    uint8_t chainOfHead[32];
+    /** \brief Chain whose head task was just run (`UINT8_MAX` if none) */
+    uint8_t chainCur;
+    /** \brief Release time of head task of that chain */
+    TKLtyp_tick_t chainRel;
+    /** \brief Time of end of most recent task run */
+    TKLtyp_tick_t chainTickEnd;
+    /** \brief Max. end-to-end latency of each chain */
+    TKLtyp_tick_t chainLatMax[32];
+    /** \brief Number of end-to-end deadline overruns of chains */
+    uint8_t chainOverrunCnt;
+#endif /* TKLSDLRCFG_CHAIN_ENA */
+#if TKLSDLRCFG_STAT_ENA
+    /** \brief Execution statistics of each task (by index within task list) */
+    TKLsdlr_statAcc_t tskStat[TKLSDLRCFG_TSK_CNT_MAX];
+#endif /* TKLSDLRCFG_STAT_ENA */
+#if TKLSDLRCFG_TSK_OVERRUN_ENA
+    /** \brief Deadline overrun counter of each task */
+    TKLsdlr_overrunCnt_t tskOverrunCntPerTsk[TKLSDLRCFG_TSK_CNT_MAX];
+    /** \brief Time of most recent deadline overrun of each task */
+    TKLtyp_tick_t tskOverrunLastTick[TKLSDLRCFG_TSK_CNT_MAX];
+    /** \brief Worst lateness of each task */
+    TKLtyp_tick_t tskOverrunWorstLateness[TKLSDLRCFG_TSK_CNT_MAX];
+#if TKLSDLRCFG_TS_ENA
+    /** \brief Execution time (time stamps) of most recent deadline overrun */
+    uint32_t tskOverrunLastExecTs[TKLSDLRCFG_TSK_CNT_MAX];
+#endif /* TKLSDLRCFG_TS_ENA */
+    /** \brief Index of most recently overrunning task */
+    uint8_t lastOverrunTsk;
+#endif /* TKLSDLRCFG_TSK_OVERRUN_ENA */
+#if TKLSDLRCFG_TRACE_ENA
+    /**
+     * \brief Trace ring buffer
+     *
+     * Single-producer (scheduler), single-consumer (user) ring buffer.  Head
+     * and tail indices are free-running 8 bit counters (atomic access on any
+     * MCU), each written by one side only, so neither side needs a critical
+     * region.
+     */
+    TKLtyp_traceEvt_t traceBuf[TKLSDLRCFG_TRACE_BUF_LEN];
+    /** \brief Index of next event to write (written by producer only) */
+    volatile uint8_t traceHead;
+    /** \brief Index of next event to read (written by consumer only) */
+    volatile uint8_t traceTail;
+    /** \brief Number of events dropped because buffer was full (saturating) */
+    volatile uint8_t traceDropCnt;
+#endif /* TKLSDLRCFG_TRACE_ENA */
+#if TKLSDLRCFG_LOAD_ENA
+    /** \brief Start time of current CPU load sub-window */
+    TKLtyp_tick_t loadSubWinStart;
+    /** \brief Bucket of current CPU load sub-window */
+    uint8_t loadBucket;
+    /**
+     * \brief Number of complete sub-windows within window
+     *
+     * Less than \ref TKLSDLRCFG_LOAD_SUBWIN_CNT only right after (re-)start
+     * of measurement.  `UINT8_MAX` if measurement needs to be (re-)started.
+     */
+    uint8_t loadSubWinCnt;
+    /**
+     * \brief Busy time (time in task runs) per sub-window bucket
+     *
+     * One bucket per complete sub-window of the window plus one for the
+     * current (incomplete) sub-window.
+     */
+    TKLtyp_tick_t loadBusy[TKLSDLRCFG_LOAD_SUBWIN_CNT + 1u];
+    /** \brief Busy time per task and sub-window bucket */
+    TKLtyp_tick_t loadTskBusy[TKLSDLRCFG_TSK_CNT_MAX]
+                             [TKLSDLRCFG_LOAD_SUBWIN_CNT + 1u];
+#endif /* TKLSDLRCFG_LOAD_ENA */
+#if TKLSDLRCFG_OVLD_ENA
+    /** \brief Criticality level of each task */
+    uint8_t ovldCrit[TKLSDLRCFG_TSK_CNT_MAX];
+    /** \brief Highest criticality level within task list */
+    uint8_t ovldCritMax;
+    /** \brief Overload level (tasks of lower criticality are shed) */
+    uint8_t ovldLvl;
+    /** \brief Number of deadline overruns within current window */
+    uint8_t ovldOverrunCnt;
+    /** \brief Start time of current overload detection window */
+    TKLtyp_tick_t ovldWinStart;
+#if 0u < TKLSDLRCFG_OVLD_STRETCH
+    /** \brief Number of releases each task skips while shed */
+    uint8_t ovldSkipCnt[TKLSDLRCFG_TSK_CNT_MAX];
+#endif /* 0u < TKLSDLRCFG_OVLD_STRETCH */
+#endif /* TKLSDLRCFG_OVLD_ENA */
+#if TKLSDLRCFG_EVT_ENA
+    /**
+     * \brief Event posted bitmap (MSB is task `0`; written by event posting
+     * side only)
+     *
+     * An event is pending for a task while its bits of posted and
+     * acknowledged bitmap differ.
+     */
+    volatile uint32_t evtPost;
+    /** \brief Event acknowledged bitmap (written by scheduler only) */
+    volatile uint32_t evtAck;
+#endif /* TKLSDLRCFG_EVT_ENA */
+#if TKLSDLRCFG_ACT_MAP_ENA
+    /** \brief Active task bitmap (MSB of word `0` is task `0`) */
+    uint32_t actMap[(TKLSDLRCFG_TSK_CNT_MAX + 31u) / 32u];
+    /**
+     * \brief Stack of records how far task list scans reached (index of last
+     * task reached)
+     */
+    uint8_t actReachIdx[TKLSDLRCFG_TSK_CNT_MAX];
+    /** \brief Stack of records how far task list scans reached (time) */
+    TKLtyp_tick_t actReachTick[TKLSDLRCFG_TSK_CNT_MAX];
+    /** \brief Number of records within stack */
+    uint8_t actReachCnt;
+    /** \brief Time of previous scheduling algorithm execution cycle */
+    TKLtyp_tick_t actTick;
+#endif /* TKLSDLRCFG_ACT_MAP_ENA */
+#if TKLSDLRCFG_REL_RECIP_ENA
+    /**
+     * \brief Reciprocal of each task's period (`0` for power of 2 periods)
+     */
+    TKLtyp_tick_t relRecip[TKLSDLRCFG_TSK_CNT_MAX];
+#endif /* TKLSDLRCFG_REL_RECIP_ENA */
+} TKLsdlr_ctx_t;
 
 /* OPERATIONS
  * ==========
@@ -34,13 +489,67 @@ typedef uint32_t (* TKLtyp_p_getTick_t)(void);
  */
 void TKLsdlr_setTickSrc(const TKLtyp_p_getTick_t p_getTick);
 
+#if TKLSDLRCFG_TS_ENA
+/**
+ * \brief Register high-resolution time stamp source with scheduler
+ *
+ * Used to measure execution times of task runs with sub-tick resolution (see
+ * \ref TKLtyp_tskStat_t and \ref TKLtyp_tskOverrun_t).  Until a source is
+ * registered, those execution times remain `0`.
+ *
+ * \param p_getTs Pointer to an access function that provides the current
+ * time stamp (free-running, wrapping at `UINT32_MAX`, e.g., time tick count
+ * times timer counts per time tick plus current timer count).  A task run must
+ * not take longer than the time stamp wrap-around period.
+ */
+void TKLsdlr_setTsSrc(const TKLtyp_p_getTs_t p_getTs);
+#endif /* TKLSDLRCFG_TS_ENA */
+
 /**
  * \brief Register a task list with scheduler
  *
- * \param p_tskLst Task list
+ * \param p_tskLst Task list (array of tasks, or structure-of-arrays task list
+ * with \ref TKLSDLRCFG_TSK_SOA_ENA; see \ref TKLSDLR_TSK_LST())
  * \param tskCnt Number of tasks within provided task list
  */
-void TKLsdlr_setTskLst(TKLtyp_tsk_t* const p_tskLst, const uint8_t tskCnt);
+void TKLsdlr_setTskLst(TKLsdlr_tskLst_t* const p_tskLst,
+                       const uint8_t tskCnt);
+
+#if TKLSDLRCFG_MODE_CHG_ENA
+/**
+ * \brief Request switching to another task list (mode change)
+ *
+ * Unlike \ref TKLsdlr_setTskLst(), which takes effect immediately, the
+ * requested task list is only buffered and switched to by
+ * \ref TKLsdlr_exec() at the start of a cycle, i.e. never while a task of the
+ * registered task list runs.  This is also safe while \ref TKLsdlr_exec() is
+ * executed within an ISR.
+ *
+ * The switch keeps task phases:
+ * * Tasks shared between both task lists (same task runner) keep their
+ *   `lastRun` time of the registered task list
+ * * Other periodic tasks keep their `lastRun` time, but releases missed
+ *   before the switch are dropped (releases at the time of the switch are
+ *   not), so that no burst of releases follows the switch
+ *
+ * Apart from that, the switch is the same as \ref TKLsdlr_setTskLst().  A
+ * release table (see \ref TKLsdlr_setRelTbl()) must be registered anew
+ * afterwards.
+ *
+ * \param p_tskLst Task list to switch to
+ * \param tskCnt Number of tasks within provided task list
+ * \param hyperperiod If not `0`, switch only at a multiple of this time tick
+ * count (at most half the time tick count range; counted from `0`, like
+ * \ref TKLTYP_CALC_OFFSET(), also across tick count rollovers, which
+ * \ref TKLsdlr_exec() keeps track of)
+ *
+ * \return `true` if request was accepted, `false` if a previous request is
+ * still pending
+ */
+bool TKLsdlr_reqTskLst(TKLsdlr_tskLst_t* const p_tskLst,
+                       const uint8_t tskCnt,
+                       const TKLtyp_tick_t hyperperiod);
+#endif /* TKLSDLRCFG_MODE_CHG_ENA */
 
 /**
  * \brief Get task list that is registered with scheduler
@@ -49,7 +558,7 @@ void TKLsdlr_setTskLst(TKLtyp_tsk_t* const p_tskLst, const uint8_t tskCnt);
  *
  * \see TKLsdlr_setTaskAttributes()
  */
-TKLtyp_tsk_t* TKLsdlr_getTskLst(void);
+TKLsdlr_tskLst_t* TKLsdlr_getTskLst(void);
 
 /**
  * \brief Get number of tasks within task list that is registered with
@@ -61,6 +570,27 @@ TKLtyp_tsk_t* TKLsdlr_getTskLst(void);
  */
 uint8_t TKLsdlr_cntTsk(void);
 
+#if TKLSDLRCFG_DM_ORDER_ENA
+/**
+ * \brief Get number of tasks within task list that is registered with
+ * scheduler whose priority (position within deadline-monotonic dispatch
+ * order) differs from their position within task list
+ *
+ * \return Number of misordered tasks (`0` if task list is already in
+ * deadline-monotonic order)
+ */
+uint8_t TKLsdlr_cntTskMisorder(void);
+
+/**
+ * \brief Get task at a position within deadline-monotonic dispatch order
+ *
+ * \param prio Position within dispatch order (`0` is highest priority)
+ *
+ * \return Index of task within task list
+ */
+uint8_t TKLsdlr_getDispTsk(const uint8_t prio);
+#endif /* TKLSDLRCFG_DM_ORDER_ENA */
+
 /**
  * \brief Get number of task deadline overruns
  *
@@ -68,9 +598,60 @@ uint8_t TKLsdlr_cntTsk(void);
  */
 uint8_t TKLsdlr_cntTskOverrun(void);
 
-/** \brief Reset Task deadline overrun counter */
+/**
+ * \brief Reset Task deadline overrun counter
+ *
+ * With per-task deadline overrun recording, also resets all per-task records.
+ */
 void TKLsdlr_clrTskOverrun(void);
 
+#if TKLSDLRCFG_TSK_OVERRUN_ENA
+/**
+ * \brief Get deadline overrun record of a task within task list that is
+ * registered with scheduler
+ *
+ * Records are reset when a task list is registered.
+ *
+ * \param tskIdx Index of task within task list
+ * \param p_tskOverrun Receives a snapshot of the task’s deadline overrun
+ * record
+ */
+void TKLsdlr_getTskOverrun(const uint8_t tskIdx,
+                           TKLtyp_tskOverrun_t* const p_tskOverrun);
+
+/**
+ * \brief Get index of most recently overrunning task
+ *
+ * Allows to pinpoint the offending task from within
+ * `TKLSDLRCFG_OVERRUN_HOOK` (also if several tasks share the same task
+ * runner).
+ *
+ * \return Index of most recently overrunning task within task list (`0` if
+ * no task has overrun yet)
+ */
+uint8_t TKLsdlr_getLastOverrunTsk(void);
+#endif /* TKLSDLRCFG_TSK_OVERRUN_ENA */
+
+#if TKLSDLRCFG_STAT_ENA
+/**
+ * \brief Get execution statistics of a task within task list that is
+ * registered with scheduler
+ *
+ * Statistics are recorded from the time ticks that the scheduler reads anyway
+ * (at start of execution cycle and end of task run), so their resolution is
+ * one time tick (except for execution times in time stamp units, see
+ * \ref TKLsdlr_setTsSrc()).  They are reset when a task list is registered.
+ *
+ * \param tskIdx Index of task within task list
+ * \param p_tskStat Receives a snapshot of the task’s execution statistics
+ */
+void TKLsdlr_getTskStat(const uint8_t tskIdx,
+                        TKLtyp_tskStat_t* const p_tskStat);
+
+/** \brief Reset execution statistics of all tasks */
+void TKLsdlr_clrTskStat(void);
+#endif /* TKLSDLRCFG_STAT_ENA */
+
 /**
  * \brief Activate/deactivate a task within task list that is registered with
  * scheduler
@@ -87,11 +668,458 @@ void TKLsdlr_setTskAct(const TKLtyp_p_tskRunner_t p_tskRunner,
                        const bool active,
                        const bool updLastRun);
 
+/**
+ * \brief Get index of a task within task list that is registered with
+ * scheduler
+ *
+ * Resolves a task (handle) once, e.g. right after
+ * \ref TKLsdlr_setTskLst(), for the index-based task activation API.  The
+ * index stays valid until another task list is registered.
+ *
+ * \param p_tskRunner Task runner of task (must be within task list; first
+ * match if several tasks share the same task runner)
+ *
+ * \return Index of task within task list
+ */
+uint8_t TKLsdlr_getTskIdx(const TKLtyp_p_tskRunner_t p_tskRunner);
+
+/**
+ * \brief Activate/deactivate a task within task list that is registered with
+ * scheduler, by its index
+ *
+ * Same as \ref TKLsdlr_setTskAct(), but in constant time (no search of task
+ * list, at most one time tick query).
+ *
+ * \param tskIdx Index of task within task list (see
+ * \ref TKLsdlr_getTskIdx())
+ * \param active Desired task activation status
+ * \param updLastRun Directive to update time stamp of last task run to
+ * current relative system time tick count
+ */
+void TKLsdlr_setTskActIdx(const uint8_t tskIdx,
+                          const bool active,
+                          const bool updLastRun);
+
+/**
+ * \brief Activate/deactivate a group of tasks within task list that is
+ * registered with scheduler
+ *
+ * Same as \ref TKLsdlr_setTskActIdx() for all tasks of the group, with one
+ * time tick query for all of them (i.e., all get the same `lastRun` time if
+ * it is updated).
+ *
+ * \param tskMask Group of tasks (bit `i` set means task with index `i`
+ * within task list; only the first 32 tasks can be grouped)
+ * \param active Desired task activation status
+ * \param updLastRun Directive to update time stamp of last task run to
+ * current relative system time tick count
+ */
+void TKLsdlr_setTskActMask(const uint32_t tskMask,
+                           const bool active,
+                           const bool updLastRun);
+
+#if TKLSDLRCFG_EVT_ENA
+/**
+ * \brief Post an event to a sporadic task (task `period` of `0`)
+ *
+ * Callable from within ISRs.  The task is released by the next scheduling
+ * algorithm execution cycle in which no enabled task with a higher priority
+ * (lower task list index) is due; the task with the highest priority pending
+ * event is found via count leading zeros instead of a task list scan.
+ * Events are not counted, i.e. an event posted to a task whose previous event
+ * is still pending is merged with it.  Events posted to a disabled task are
+ * dropped when due.
+ *
+ * Posting is lock free, but posting contexts must not preempt each other
+ * (e.g., post from ISRs of one priority level only, or wrap posting from
+ * within the main loop into a critical region).
+ *
+ * \param tskIdx Index of sporadic task within task list (must be less than
+ * `32`)
+ */
+void TKLsdlr_postEvt(const uint8_t tskIdx);
+#endif /* TKLSDLRCFG_EVT_ENA */
+
+#if TKLSDLRCFG_TRACE_ENA
+/**
+ * \brief Fetch oldest event from trace ring buffer
+ *
+ * Lock-free, i.e. may be called from any (single) context, e.g. a low priority
+ * task or an ISR, concurrently to the scheduler.  Events are recorded by the
+ * scheduler, \ref TKLsdlr_exec() and \ref TKLsdlr_setTskAct() (which thus must
+ * only be called from one context).  Both contexts must run on the same core
+ * (see \ref TKLSDLR_BARRIER()).
+ *
+ * Each task run records a release (at ideal release time, `lastRun`), start
+ * and end event, optionally followed by an overrun event.
+ *
+ * \param p_traceEvt Receives oldest event, if any
+ *
+ * \return `true` if an event was fetched, `false` if buffer is empty
+ */
+bool TKLsdlr_getTraceEvt(TKLtyp_traceEvt_t* const p_traceEvt);
+
+/**
+ * \brief Get number of trace events dropped because trace ring buffer was
+ * full
+ *
+ * \return Number of dropped trace events (saturates at `UINT8_MAX`)
+ */
+uint8_t TKLsdlr_cntTraceDrop(void);
+#endif /* TKLSDLRCFG_TRACE_ENA */
+
+#if TKLSDLRCFG_LOAD_ENA
+/**
+ * \brief Get measured total CPU load
+ *
+ * CPU load is the time spent in task runs divided by the elapsed time, over
+ * the last `TKLSDLRCFG_LOAD_WIN` time ticks (sliding by sub-windows).  Busy
+ * time is measured with the time ticks that the scheduler reads anyway, so
+ * task runs shorter than one time tick are only accounted when they cross a
+ * time tick boundary; use a (sub-)window spanning many task runs.  Time spent
+ * in ISRs during task runs is accounted as busy, other ISR time as idle.
+ *
+ * Measurement (re-)starts when a task list is registered.
+ *
+ * \return CPU load in 0.01 % (i.e., `10000` is 100 %)
+ */
+uint16_t TKLsdlr_getCpuLoad(void);
+
+/**
+ * \brief Get measured CPU load of a task within task list that is registered
+ * with scheduler
+ *
+ * See \ref TKLsdlr_getCpuLoad().
+ *
+ * \param tskIdx Index of task within task list
+ *
+ * \return CPU load of task in 0.01 % (i.e., `10000` is 100 %)
+ */
+uint16_t TKLsdlr_getTskCpuLoad(const uint8_t tskIdx);
+#endif /* TKLSDLRCFG_LOAD_ENA */
+
+#if TKLSDLRCFG_OVLD_ENA
+/**
+ * \brief Set criticality level of a task within task list that is registered
+ * with scheduler
+ *
+ * Under overload, tasks are shed in order of increasing criticality (see
+ * \ref TKLSDLRCFG_OVLD_ENA); tasks of the highest criticality within the task
+ * list (e.g., those with hard deadlines) are never shed.  All tasks have
+ * criticality `0` after a task list is registered, so that none is shed
+ * unless criticality levels are set.
+ *
+ * \param tskIdx Index of task within task list
+ * \param crit Criticality level (higher is more critical)
+ */
+void TKLsdlr_setTskCrit(const uint8_t tskIdx, const uint8_t crit);
+
+/**
+ * \brief Get overload level
+ *
+ * \return Overload level (tasks of lower criticality are shed; `0` if there
+ * is no overload)
+ */
+uint8_t TKLsdlr_getOvldLvl(void);
+#endif /* TKLSDLRCFG_OVLD_ENA */
+
+/**
+ * \brief Get number of time ticks until next release of an enabled task
+ *
+ * Allows the main endless "super loop" to sleep until then (see also
+ * `TKLSDLRCFG_IDLE_HOOK`).  With the priority queue engine or release table,
+ * disabled tasks are not filtered, so the result might be earlier than
+ * necessary (but never later).
+ *
+ * \return Number of time ticks until next task release, `0` if a task is due
+ * to run, \ref TKLTYP_TICK_MAX if no task is enabled
+ */
+TKLtyp_tick_t TKLsdlr_cntTickToNextRel(void);
+
 /**
  * \brief Scheduling algorithm execution cycle
  *
  * This function needs to be called from within main endless "super loop".
+ * If no task was run, the custom idle hook `TKLSDLRCFG_IDLE_HOOK` (if
+ * defined) is run at the end of the cycle.
  */
 void TKLsdlr_exec(void);
 
+#if TKLSDLRCFG_CHAIN_ENA
+/**
+ * \brief Register task chains of task list that is registered with scheduler
+ *
+ * When a head task of a chain is run, \ref TKLsdlr_exec() runs its
+ * consumers (and theirs, and so on) right after it, within the same cycle,
+ * in task list order (priority) among released consumers.  A consumer is only
+ * released once all its producers have finished.  Disabled consumers are not
+ * run but count as finished.  The chain's end-to-end latency (from release of
+ * head task until end of last task of chain) is then checked against its
+ * deadline.
+ *
+ * Registration is cleared when a task list is registered.
+ *
+ * \param p_chainTbl Task chains (for at most 32 tasks; consumers must be
+ * sporadic tasks, each within a single chain, and no chain may be cyclic)
+ */
+void TKLsdlr_setChainTbl(const TKLtyp_chainTbl_t* const p_chainTbl);
+
+/**
+ * \brief Get max. measured end-to-end latency of a chain
+ *
+ * \param chainIdx Index of chain within registered task chains
+ *
+ * \return Max. end-to-end latency (`0` if chain has not been run yet)
+ */
+TKLtyp_tick_t TKLsdlr_getChainLat(const uint8_t chainIdx);
+
+/**
+ * \brief Get number of end-to-end deadline overruns of chains
+ *
+ * \return Number of end-to-end deadline overruns (saturates at `UINT8_MAX`)
+ */
+uint8_t TKLsdlr_cntChainOverrun(void);
+#endif /* TKLSDLRCFG_CHAIN_ENA */
+
+#if TKLSDLRCFG_RELTBL_ENA
+/**
+ * \brief Register a precomputed static cyclic schedule (release table) with
+ * scheduler
+ *
+ * The release table must have been generated (via `util/rel-tbl-gen.py`) for
+ * the task list that is currently registered with the scheduler, which is
+ * verified.
+ * Its hyperperiod is assumed to start at relative system time tick count `0`
+ * and must be at most half the time tick count range (so that the time until
+ * the first release slot of the next hyperperiod is representable).
+ *
+ * \param p_relTbl Release table
+ */
+void TKLsdlr_setRelTbl(const TKLtyp_relTbl_t* const p_relTbl);
+
+/**
+ * \brief Scheduling algorithm execution cycle driven by release table
+ *
+ * Variant of \ref TKLsdlr_exec() that takes task releases from the registered
+ * release table instead of checking every task for being due to run.  Its
+ * cost per cycle is thus independent of the number of tasks in task list.
+ * Run tasks, `lastRun` alignment, deadline overrun detection and (on tick
+ * loss) catch-up are the same.  The only difference is that `lastRun` is
+ * updated right at release time (also for disabled tasks).
+ *
+ * Time stamps of last task runs must not be changed at run time (release
+ * times would no longer match the release table), i.e.,
+ * \ref TKLsdlr_setTskAct() must not be used with `updLastRun`.
+ *
+ * This function needs to be called from within main endless "super loop".
+ */
+void TKLsdlr_execTbl(void);
+#endif /* TKLSDLRCFG_RELTBL_ENA */
+
+/**
+ * \brief Get (ideal) release time of a due-to-run task, i.e. start of its
+ * latest period that has started
+ *
+ * Same as `tickCnt - ((tickCnt - lastRun) % period)` (still correct on tick
+ * count rollover), but without division in the common case that no period
+ * was lost.  With \ref TKLSDLRCFG_REL_RECIP_ENA, also without division
+ * otherwise.  Used by the scheduler and shared with other executors (e.g.,
+ * `TKLmt`), so that they release tasks the same.
+ *
+ * \param period Period of task
+ * \param lastRun Time stamp of last task run (task must be due to run, i.e.
+ * `tickCnt - lastRun >= period`)
+ * \param tickCnt Relative system time tick count
+ * \param relRecip Reciprocal of period (see \ref TKLsdlr_calcRelRecip());
+ * unused unless \ref TKLSDLRCFG_REL_RECIP_ENA
+ *
+ * \return Release time
+ */
+TKLtyp_tick_t TKLsdlr_calcRel(const TKLtyp_tick_t period,
+                              const TKLtyp_tick_t lastRun,
+                              const TKLtyp_tick_t tickCnt,
+                              const TKLtyp_tick_t relRecip);
+
+/**
+ * \brief Precompute reciprocal of a task period for \ref TKLsdlr_calcRel()
+ *
+ * For a period `p` that is no power of 2, `floor((2^n - 1) / p)` equals
+ * `floor(2^n / p)`, which underestimates the quotient of any `n` bit dividend
+ * by less than 1 (`n` is the time tick width).  Power of 2 periods
+ * (including sporadic tasks) get `0` and are handled via bit mask instead.
+ *
+ * \param period Period of task
+ *
+ * \return Reciprocal of period, `0` for power of 2 periods
+ */
+TKLtyp_tick_t TKLsdlr_calcRelRecip(const TKLtyp_tick_t period);
+
+/* Instance (context) API
+ * ----------------------
+ *
+ * Each `TKLsdlr_<op>()` function above operates on a default instance and has
+ * an instance variant `TKLsdlr_ctx<Op>()` that operates on the scheduler
+ * instance `me` instead (with otherwise same semantics).
+ * The optional hooks (`TKLSDLRCFG_OVERRUN_HOOK`, `TKLSDLRCFG_IDLE_HOOK`) are
+ * shared by all instances, i.e. an instance that is executed within an ISR
+ * typically must not be idle-hooked to sleep.
+ */
+
+/**
+ * \brief Initialize a scheduler instance
+ *
+ * Must be called before any other function on the instance (unless the
+ * instance is zero initialized anyway).
+ *
+ * \param me Scheduler instance
+ */
+void TKLsdlr_ctxInit(TKLsdlr_ctx_t* const me);
+
+/** \brief Instance variant of \ref TKLsdlr_setTickSrc() */
+void TKLsdlr_ctxSetTickSrc(TKLsdlr_ctx_t* const me,
+                           const TKLtyp_p_getTick_t p_getTick);
+
+#if TKLSDLRCFG_TS_ENA
+/** \brief Instance variant of \ref TKLsdlr_setTsSrc() */
+void TKLsdlr_ctxSetTsSrc(TKLsdlr_ctx_t* const me,
+                         const TKLtyp_p_getTs_t p_getTs);
+#endif /* TKLSDLRCFG_TS_ENA */
+
+/** \brief Instance variant of \ref TKLsdlr_setTskLst() */
+void TKLsdlr_ctxSetTskLst(TKLsdlr_ctx_t* const me,
+                          TKLsdlr_tskLst_t* const p_tskLst,
+                          const uint8_t tskCnt);
+
+#if TKLSDLRCFG_MODE_CHG_ENA
+/** \brief Instance variant of \ref TKLsdlr_reqTskLst() */
+bool TKLsdlr_ctxReqTskLst(TKLsdlr_ctx_t* const me,
+                          TKLsdlr_tskLst_t* const p_tskLst,
+                          const uint8_t tskCnt,
+                          const TKLtyp_tick_t hyperperiod);
+#endif /* TKLSDLRCFG_MODE_CHG_ENA */
+
+/** \brief Instance variant of \ref TKLsdlr_getTskLst() */
+TKLsdlr_tskLst_t* TKLsdlr_ctxGetTskLst(const TKLsdlr_ctx_t* const me);
+
+/** \brief Instance variant of \ref TKLsdlr_cntTsk() */
+uint8_t TKLsdlr_ctxCntTsk(const TKLsdlr_ctx_t* const me);
+
+#if TKLSDLRCFG_DM_ORDER_ENA
+/** \brief Instance variant of \ref TKLsdlr_cntTskMisorder() */
+uint8_t TKLsdlr_ctxCntTskMisorder(const TKLsdlr_ctx_t* const me);
+
+/** \brief Instance variant of \ref TKLsdlr_getDispTsk() */
+uint8_t TKLsdlr_ctxGetDispTsk(const TKLsdlr_ctx_t* const me,
+                              const uint8_t prio);
+#endif /* TKLSDLRCFG_DM_ORDER_ENA */
+
+/** \brief Instance variant of \ref TKLsdlr_cntTskOverrun() */
+uint8_t TKLsdlr_ctxCntTskOverrun(const TKLsdlr_ctx_t* const me);
+
+/** \brief Instance variant of \ref TKLsdlr_clrTskOverrun() */
+void TKLsdlr_ctxClrTskOverrun(TKLsdlr_ctx_t* const me);
+
+#if TKLSDLRCFG_TSK_OVERRUN_ENA
+/** \brief Instance variant of \ref TKLsdlr_getTskOverrun() */
+void TKLsdlr_ctxGetTskOverrun(const TKLsdlr_ctx_t* const me,
+                              const uint8_t tskIdx,
+                              TKLtyp_tskOverrun_t* const p_tskOverrun);
+
+/** \brief Instance variant of \ref TKLsdlr_getLastOverrunTsk() */
+uint8_t TKLsdlr_ctxGetLastOverrunTsk(const TKLsdlr_ctx_t* const me);
+#endif /* TKLSDLRCFG_TSK_OVERRUN_ENA */
+
+#if TKLSDLRCFG_STAT_ENA
+/** \brief Instance variant of \ref TKLsdlr_getTskStat() */
+void TKLsdlr_ctxGetTskStat(const TKLsdlr_ctx_t* const me,
+                           const uint8_t tskIdx,
+                           TKLtyp_tskStat_t* const p_tskStat);
+
+/** \brief Instance variant of \ref TKLsdlr_clrTskStat() */
+void TKLsdlr_ctxClrTskStat(TKLsdlr_ctx_t* const me);
+#endif /* TKLSDLRCFG_STAT_ENA */
+
+/** \brief Instance variant of \ref TKLsdlr_setTskAct() */
+void TKLsdlr_ctxSetTskAct(TKLsdlr_ctx_t* const me,
+                          const TKLtyp_p_tskRunner_t p_tskRunner,
+                          const bool active,
+                          const bool updLastRun);
+
+/** \brief Instance variant of \ref TKLsdlr_getTskIdx() */
+uint8_t TKLsdlr_ctxGetTskIdx(const TKLsdlr_ctx_t* const me,
+                             const TKLtyp_p_tskRunner_t p_tskRunner);
+
+/** \brief Instance variant of \ref TKLsdlr_setTskActIdx() */
+void TKLsdlr_ctxSetTskActIdx(TKLsdlr_ctx_t* const me,
+                             const uint8_t tskIdx,
+                             const bool active,
+                             const bool updLastRun);
+
+/** \brief Instance variant of \ref TKLsdlr_setTskActMask() */
+void TKLsdlr_ctxSetTskActMask(TKLsdlr_ctx_t* const me,
+                              const uint32_t tskMask,
+                              const bool active,
+                              const bool updLastRun);
+
+#if TKLSDLRCFG_EVT_ENA
+/** \brief Instance variant of \ref TKLsdlr_postEvt() */
+void TKLsdlr_ctxPostEvt(TKLsdlr_ctx_t* const me, const uint8_t tskIdx);
+#endif /* TKLSDLRCFG_EVT_ENA */
+
+#if TKLSDLRCFG_TRACE_ENA
+/** \brief Instance variant of \ref TKLsdlr_getTraceEvt() */
+bool TKLsdlr_ctxGetTraceEvt(TKLsdlr_ctx_t* const me,
+                            TKLtyp_traceEvt_t* const p_traceEvt);
+
+/** \brief Instance variant of \ref TKLsdlr_cntTraceDrop() */
+uint8_t TKLsdlr_ctxCntTraceDrop(const TKLsdlr_ctx_t* const me);
+#endif /* TKLSDLRCFG_TRACE_ENA */
+
+#if TKLSDLRCFG_LOAD_ENA
+/** \brief Instance variant of \ref TKLsdlr_getCpuLoad() */
+uint16_t TKLsdlr_ctxGetCpuLoad(TKLsdlr_ctx_t* const me);
+
+/** \brief Instance variant of \ref TKLsdlr_getTskCpuLoad() */
+uint16_t TKLsdlr_ctxGetTskCpuLoad(TKLsdlr_ctx_t* const me,
+                                  const uint8_t tskIdx);
+#endif /* TKLSDLRCFG_LOAD_ENA */
+
+#if TKLSDLRCFG_OVLD_ENA
+/** \brief Instance variant of \ref TKLsdlr_setTskCrit() */
+void TKLsdlr_ctxSetTskCrit(TKLsdlr_ctx_t* const me,
+                           const uint8_t tskIdx,
+                           const uint8_t crit);
+
+/** \brief Instance variant of \ref TKLsdlr_getOvldLvl() */
+uint8_t TKLsdlr_ctxGetOvldLvl(const TKLsdlr_ctx_t* const me);
+#endif /* TKLSDLRCFG_OVLD_ENA */
+
+/** \brief Instance variant of \ref TKLsdlr_cntTickToNextRel() */
+TKLtyp_tick_t TKLsdlr_ctxCntTickToNextRel(TKLsdlr_ctx_t* const me);
+
+/** \brief Instance variant of \ref TKLsdlr_exec() */
+void TKLsdlr_ctxExec(TKLsdlr_ctx_t* const me);
+
+#if TKLSDLRCFG_CHAIN_ENA
+/** \brief Instance variant of \ref TKLsdlr_setChainTbl() */
+void TKLsdlr_ctxSetChainTbl(TKLsdlr_ctx_t* const me,
+                            const TKLtyp_chainTbl_t* const p_chainTbl);
+
+/** \brief Instance variant of \ref TKLsdlr_getChainLat() */
+TKLtyp_tick_t TKLsdlr_ctxGetChainLat(const TKLsdlr_ctx_t* const me,
+                                     const uint8_t chainIdx);
+
+/** \brief Instance variant of \ref TKLsdlr_cntChainOverrun() */
+uint8_t TKLsdlr_ctxCntChainOverrun(const TKLsdlr_ctx_t* const me);
+#endif /* TKLSDLRCFG_CHAIN_ENA */
+
+#if TKLSDLRCFG_RELTBL_ENA
+/** \brief Instance variant of \ref TKLsdlr_setRelTbl() */
+void TKLsdlr_ctxSetRelTbl(TKLsdlr_ctx_t* const me,
+                          const TKLtyp_relTbl_t* const p_relTbl);
+
+/** \brief Instance variant of \ref TKLsdlr_execTbl() */
+void TKLsdlr_ctxExecTbl(TKLsdlr_ctx_t* const me);
+#endif /* TKLSDLRCFG_RELTBL_ENA */
+
 #endif /* TKLSDLR_H */
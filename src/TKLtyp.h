@@ -8,6 +8,23 @@
 #include "stdint.h"
 #include "stdbool.h"
 
+#include "TKLsdlrCfg.h" /* Provides time tick width */
+
+#if 16 == TKLSDLRCFG_TICK_WIDTH
+/** \brief Relative system time tick count type */
+typedef uint16_t TKLtyp_tick_t;
+/** \brief Max. value of \ref TKLtyp_tick_t */
+#define TKLTYP_TICK_MAX UINT16_MAX
+#elif !defined(TKLSDLRCFG_TICK_WIDTH) || (32 == TKLSDLRCFG_TICK_WIDTH)
+typedef uint32_t TKLtyp_tick_t;
+#define TKLTYP_TICK_MAX UINT32_MAX
+#elif 64 == TKLSDLRCFG_TICK_WIDTH
+typedef uint64_t TKLtyp_tick_t;
+#define TKLTYP_TICK_MAX UINT64_MAX
+#else
+#error "TKLSDLRCFG_TICK_WIDTH must be 16, 32 or 64"
+#endif /* TKLSDLRCFG_TICK_WIDTH */
+
 /**
  * \brief Helper to calc. positive offset from `0` for \ref TKLtyp_tsk_t.lastRun
  *
@@ -16,7 +33,8 @@
  *
  * See \ref TKLtyp_tsk_t.lastRun for more details.
  */
-#define TKLTYP_CALC_OFFSET(period_, offset_) (0u - (period_) + (offset_))
+#define TKLTYP_CALC_OFFSET(period_, offset_) \
+    ((TKLtyp_tick_t)((TKLtyp_tick_t)0u - (period_) + (offset_)))
 
 /** \brief Task runner function signature */
 typedef void (* TKLtyp_p_tskRunner_t)(void);
@@ -34,8 +52,12 @@ typedef struct {
     /**
      * \brief Time (since previous task run) after which task will be run
      * again Must not be `0`!
+     *
+     * Exception:  With event-driven sporadic tasks enabled
+     * (`TKLSDLRCFG_EVT_ENA`), `0` marks a sporadic task that is only run on
+     * posted events.
      */
-    const uint32_t period;
+    const TKLtyp_tick_t period;
 
     /**
      * \brief Deadline when task has to finish its execution
@@ -43,7 +65,7 @@ typedef struct {
      * This should be equal to task’s WCET + some buffer time.  Must not be
      * `0`!  The allowed range is `[WCET, period]`.
      */
-    const uint32_t deadline;
+    const TKLtyp_tick_t deadline;
 
     /** \brief Time stamp of last task run
      *
@@ -54,10 +76,262 @@ typedef struct {
      * by `delta` by defining offset `0 - delta`.  The useful range for offset
      * `delta` is `]0, period[`.
      */
-    volatile uint32_t lastRun;
+    volatile TKLtyp_tick_t lastRun;
 
     /** \brief Function pointer to task runner */
     const TKLtyp_p_tskRunner_t p_tskRunner;
 } TKLtyp_tsk_t;
 
+/**
+ * \brief Hot part of a task (structure-of-arrays task list layout)
+ *
+ * Holds only what the scheduler evaluates for every task in every execution
+ * cycle.  See \ref TKLtyp_tsk_t for the meaning of the members.
+ */
+typedef struct {
+    /** \brief See \ref TKLtyp_tsk_t.period */
+    const TKLtyp_tick_t period;
+
+    /** \brief See \ref TKLtyp_tsk_t.lastRun */
+    volatile TKLtyp_tick_t lastRun;
+} TKLtyp_tskHot_t;
+
+/**
+ * \brief Cold part of a task (structure-of-arrays task list layout)
+ *
+ * Only accessed when a task is run.  See \ref TKLtyp_tsk_t for the meaning of
+ * the members.
+ */
+typedef struct {
+    /** \brief See \ref TKLtyp_tsk_t.deadline */
+    const TKLtyp_tick_t deadline;
+
+    /** \brief See \ref TKLtyp_tsk_t.p_tskRunner */
+    const TKLtyp_p_tskRunner_t p_tskRunner;
+} TKLtyp_tskCold_t;
+
+/**
+ * \brief Task list in structure-of-arrays layout
+ *
+ * Alternative to an array of \ref TKLtyp_tsk_t that splits the tasks into
+ * parallel arrays (all indexed by task index), so that the scan over all tasks
+ * only touches the compact hot array and the activation status array (no
+ * padding), while the cold array is only accessed on task dispatch (and can be
+ * `const`).
+ */
+typedef struct {
+    /** \brief Hot parts of tasks */
+    TKLtyp_tskHot_t* const p_hot;
+
+    /** \brief Activation status of tasks (see \ref TKLtyp_tsk_t.active) */
+    volatile bool* const p_active;
+
+    /** \brief Cold parts of tasks */
+    const TKLtyp_tskCold_t* const p_cold;
+} TKLtyp_tskLstSoa_t;
+
+/**
+ * \brief Execution statistics of a task
+ *
+ * All times are in time ticks and relative to the task’s ideal release time
+ * (i.e., its `lastRun` time stamp right before the run), unless noted
+ * otherwise.  All values are `0` if the task has not been run yet.
+ */
+typedef struct {
+    /** \brief Number of task runs (saturates at `UINT32_MAX`) */
+    uint32_t runCnt;
+
+    /**
+     * \{
+     * \brief Execution time (time from start to end of task run)
+     *
+     * The max. value is a measured WCET.
+     */
+    TKLtyp_tick_t execMin;
+    TKLtyp_tick_t execMax;
+    TKLtyp_tick_t execMean;
+    /** \} */
+
+#if TKLSDLRCFG_TS_ENA
+    /**
+     * \{
+     * \brief Execution time in time stamp units (see \ref TKLsdlr_setTsSrc())
+     *
+     * Same as above, but with the resolution of the time stamp source (e.g.,
+     * for feeding back measured WCETs with sub-tick precision).
+     */
+    uint32_t execTsMin;
+    uint32_t execTsMax;
+    uint32_t execTsMean;
+    /** \} */
+#endif /* TKLSDLRCFG_TS_ENA */
+
+    /**
+     * \{
+     * \brief Response time (time from release to end of task run)
+     *
+     * Must not exceed task’s deadline.
+     */
+    TKLtyp_tick_t respMin;
+    TKLtyp_tick_t respMax;
+    TKLtyp_tick_t respMean;
+    /** \} */
+
+    /**
+     * \brief Release jitter
+     *
+     * Difference between max. and min. start delay (time from release to start
+     * of task run).
+     */
+    TKLtyp_tick_t relJitter;
+} TKLtyp_tskStat_t;
+
+/**
+ * \brief Deadline overrun record of a task
+ *
+ * All values are `0` if the task has not overrun its deadline yet.
+ */
+typedef struct {
+    /**
+     * \brief Number of deadline overruns
+     *
+     * Saturates at max. value of configured counter width.
+     */
+    uint32_t cnt;
+
+    /** \brief Time (at end of task run) of most recent deadline overrun */
+    TKLtyp_tick_t lastTick;
+
+    /**
+     * \brief Worst lateness observed
+     *
+     * Time in time ticks by which the task finished late (i.e., response time
+     * minus deadline).
+     */
+    TKLtyp_tick_t worstLateness;
+#if TKLSDLRCFG_TS_ENA
+
+    /**
+     * \brief Execution time in time stamp units (see \ref TKLsdlr_setTsSrc())
+     * of most recent deadline overrun
+     */
+    uint32_t lastExecTs;
+#endif /* TKLSDLRCFG_TS_ENA */
+} TKLtyp_tskOverrun_t;
+
+/**
+ * \{
+ * \brief Trace event types
+ */
+#define TKLTYP_TRACE_REL 0u /**< Task released (at ideal release time) */
+#define TKLTYP_TRACE_START 1u /**< Task run started */
+#define TKLTYP_TRACE_END 2u /**< Task run ended */
+#define TKLTYP_TRACE_OVERRUN 3u /**< Task overran its deadline */
+#define TKLTYP_TRACE_ENA 4u /**< Task enabled */
+#define TKLTYP_TRACE_DIS 5u /**< Task disabled */
+/** \} */
+
+/** \brief Trace event */
+typedef struct {
+    /** \brief Time stamp (relative system time tick count) */
+    TKLtyp_tick_t tick;
+
+    /** \brief Index of task within task list */
+    uint8_t tskIdx;
+
+    /** \brief Event type (`TKLTYP_TRACE_...`) */
+    uint8_t typ;
+} TKLtyp_traceEvt_t;
+
+/** \brief Release slot of a precomputed static cyclic schedule */
+typedef struct {
+    /** \brief Release time relative to begin of hyperperiod */
+    const TKLtyp_tick_t tick;
+
+    /**
+     * \brief Tasks released at this time
+     *
+     * Bit `i` set means task with index `i` within task list is released.
+     */
+    const uint32_t tskMask;
+} TKLtyp_relSlot_t;
+
+/**
+ * \brief Precomputed static cyclic schedule (release table) of a task list
+ *
+ * Generated by `util/rel-tbl-gen.py` from the periods and offsets of a task
+ * list.
+ */
+typedef struct {
+    /**
+     * \brief Hyperperiod (least common multiple of all task periods; at most
+     * half the time tick count range)
+     */
+    const TKLtyp_tick_t hyperperiod;
+
+    /** \brief Number of release slots within hyperperiod */
+    const uint32_t slotCnt;
+
+    /** \brief Release slots, sorted by ascending release time */
+    const TKLtyp_relSlot_t* const p_slot;
+
+    /** \brief Number of tasks the release table was generated for */
+    const uint8_t tskCnt;
+
+    /**
+     * \brief Period of each task the release table was generated for
+     *
+     * Used to verify that release table and task list match.
+     */
+    const TKLtyp_tick_t* const p_period;
+
+    /**
+     * \brief Time of first release (offset) of each task the release table
+     * was generated for
+     *
+     * Used to verify that release table and task list match.
+     */
+    const TKLtyp_tick_t* const p_offset;
+} TKLtyp_relTbl_t;
+
+/** \brief Task chain (see \ref TKLtyp_chainTbl_t) */
+typedef struct {
+    /** \brief Index of head task (first producer of chain) within task list */
+    const uint8_t headTsk;
+
+    /**
+     * \brief End-to-end deadline
+     *
+     * Max. time from release of head task until all tasks of the chain have
+     * finished.
+     */
+    const TKLtyp_tick_t deadline;
+} TKLtyp_chain_t;
+
+/**
+ * \brief Task chains (small producer/consumer DAGs) of a task list
+ *
+ * When a task of a chain finishes, each of its consumers, all producers of
+ * which have finished then, is released and run right away (within the same
+ * scheduling algorithm execution cycle).
+ */
+typedef struct {
+    /** \brief Number of chains */
+    const uint8_t chainCnt;
+
+    /** \brief Chains */
+    const TKLtyp_chain_t* const p_chain;
+
+    /** \brief Number of tasks the chains are defined for */
+    const uint8_t tskCnt;
+
+    /**
+     * \brief Consumers of each task
+     *
+     * Bit `i` set means task with index `i` within task list is a consumer
+     * (i.e., released when all its producers finished).
+     */
+    const uint32_t* const p_cons;
+} TKLtyp_chainTbl_t;
+
 #endif /* TKLTYP_H */
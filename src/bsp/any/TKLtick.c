@@ -10,8 +10,10 @@
  * \brief Relative system time tick count
  *
  * Attribute is accessed from ISR *and* "normal" code, hence `volatile`.
+ * Only written by the time tick ISR (and with interrupts disabled otherwise),
+ * but read without disabling interrupts (see \ref TKLtick_getTick()).
  */
-static volatile uint32_t pv_tickCnt;
+static volatile TKLtyp_tick_t pv_tickCnt;
 
 /* OPERATIONS
  * ==========
@@ -21,10 +23,16 @@ void TKLtick_init(void) {
     TKLtimer_init(); /* Call init. of MCU timer */
 }
 
-uint32_t TKLtick_getTick(void) {
-    TKLINT_DIS();
-    const uint32_t tickCnt = pv_tickCnt;
-    TKLINT_ENA();
+TKLtyp_tick_t TKLtick_getTick(void) {
+    TKLtyp_tick_t tickCnt = pv_tickCnt;
+    TKLtyp_tick_t tickCntPrev;
+
+    /* Re-read until two consecutive reads match (see header for proof that
+       the result is never torn) */
+    do {
+        tickCntPrev = tickCnt;
+        tickCnt = pv_tickCnt;
+    } while (tickCntPrev != tickCnt);
 
     return(tickCnt);
 }
@@ -33,8 +41,27 @@ void TKLtick_incrTick(void) {
     pv_tickCnt++; /* No crit. region needed, only called from ISR */
 }
 
+void TKLtick_sleep(const TKLtick_p_cntTick_t p_cntTickToNextRel) {
+    TKLint_status_t intStatus;
+
+    /* Query with ISRs disabled, so that no task released by an ISR in between
+       query and sleep is missed, and query again after each wake-up, as any
+       ISR serviced meanwhile (not only the time tick ISR) might have released
+       a task */
+    TKLINT_SAVE_DIS(intStatus);
+    while (0u != (*p_cntTickToNextRel)()) {
+        /* Enable ISRs and sleep atomically, so that no wake-up is missed */
+        TKLtimer_idle();
+        TKLINT_DIS();
+    }
+
+    TKLINT_RESTORE(intStatus);
+}
+
 void TKLtick_clrTick(void) {
-    TKLINT_DIS();
+    TKLint_status_t intStatus;
+
+    TKLINT_SAVE_DIS(intStatus);
     pv_tickCnt = 0u;
-    TKLINT_ENA();
+    TKLINT_RESTORE(intStatus);
 }
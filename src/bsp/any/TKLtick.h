@@ -5,9 +5,16 @@
 
 #include <stdint.h>
 
+#include "TKLtyp.h" /* Provides time tick type */
 #include "TKLint.h"
 #include "TKLtimer.h"
 
+/**
+ * \brief Query function signature for number of time ticks until next task
+ * release (see \ref TKLtick_sleep())
+ */
+typedef TKLtyp_tick_t (* TKLtick_p_cntTick_t)(void);
+
 /* OPERATIONS
  * ==========
  */
@@ -16,15 +23,52 @@
 void TKLtick_init(void);
 
 /**
- * \brief Initialize the Time Tick module
+ * \brief Get the Time Tick module’s relative system time tick count
+ *
+ * Never disables interrupts, so it adds nothing to the interrupt latency of
+ * other ISRs and keeps the caller’s interrupt status untouched.  Instead, the
+ * count is read repeatedly until two consecutive reads match.  The result is
+ * never torn, even if the count is wider than the MCU’s atomic access (e.g.,
+ * byte-wise reads on 8 bit MCUs):  The count is only ever incremented by one
+ * (\ref TKLtick_incrTick()).  A read is only torn if such an increment carries
+ * into a more significant byte while the bytes are read, and a torn value
+ * differs by at least 255 from the count both before and after that
+ * increment.  Two consecutive reads thus only match with one of them torn if
+ * at least 255 ticks elapse in between, and with both of them torn if two
+ * such carries (at least 256 ticks apart) occur in between.  As two reads
+ * take far less than 255 ticks, matching reads are never torn.
+ *
+ * Must not be called from an ISR that can interrupt the time tick ISR
+ * (nested interrupts), as it could then observe a partially written count.
  *
  * \return Current relative system time tick count
  */
-uint32_t TKLtick_getTick(void);
+TKLtyp_tick_t TKLtick_getTick(void);
 
 /** \brief Increment the Time Tick module’s relative system time tick count */
 void TKLtick_incrTick(void);
 
+/**
+ * \brief Put the MCU to sleep until the next task release
+ *
+ * Intended to be called from the main endless "super loop" after each
+ * scheduler algorithm execution cycle (or used as the Taskuler scheduler’s
+ * idle hook), e.g.:
+ * `TKLtick_sleep(&TKLsdlr_cntTickToNextRel);`
+ *
+ * The number of time ticks until the next task release is queried with
+ * interrupts disabled, right before sleeping and again after each wake-up (by
+ * any interrupt).  This way, no task released (e.g., event posted or task
+ * enabled) by an interrupt is missed, neither if it occurs right before going
+ * to sleep nor if it is serviced together with the time tick interrupt.
+ * Interrupts are enabled while sleeping; on return, the caller’s interrupt
+ * status is restored.
+ *
+ * \param p_cntTickToNextRel Query function for number of time ticks until next
+ * task release (`0` if a task is due); called with interrupts disabled
+ */
+void TKLtick_sleep(const TKLtick_p_cntTick_t p_cntTickToNextRel);
+
 /**
  * \brief Reset the Time Tick module’s relative system time tick count
  *
@@ -33,6 +77,8 @@ void TKLtick_incrTick(void);
  * will be due to run at the very first scheduler algorithm execution cycle (if
  * the time tick count has progressed far enough), as this can cause
  * schedulability issues.
+ *
+ * Restores the caller’s interrupt status on return.
  */
 void TKLtick_clrTick(void);
 
@@ -3,6 +3,7 @@
 #ifndef TKLINT_H
 #define TKLINT_H
 
+#include <stdint.h>
 #include <stdbool.h>
 
 #include <avr/interrupt.h> /* Provides AVR MCU interrupt handling */
@@ -15,4 +16,24 @@
 #define TKLINT_DIS() cli()
 /** \} */
 
+/** \brief Saved interrupt status (status register incl. global int. flag) */
+typedef uint8_t TKLint_status_t;
+
+/**
+ * \{
+ * \brief Wrapper to save interrupt status and disable interrupts, and to
+ * restore saved interrupt status
+ *
+ * Unlike \ref TKLINT_ENA(), restoring leaves interrupts disabled if they were
+ * already disabled before saving, so critical sections can be nested and
+ * entered from code that runs with interrupts disabled.
+ */
+#define TKLINT_SAVE_DIS(status_) \
+    do { \
+        (status_) = SREG; \
+        cli(); \
+    } while (false)
+#define TKLINT_RESTORE(status_) (SREG = (status_))
+/** \} */
+
 #endif /* TKLINT_H */
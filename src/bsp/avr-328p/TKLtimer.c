@@ -10,6 +10,8 @@
  * `f_CPU / prescaleVal / (timer0MaxVal - timer0PreloadVal) = f_req`  
  * `=> timer0MaxVal - (f_CPU / prescaleVal / f_req)`
  * `= timer0PreloadVal = 2^8 - (16e6 Hz / 64 / 1e3 Hz) = 6`
+ *
+ * Must match \ref TKLTIMER_TS_PER_TICK (`2^8 - timer0PreloadVal`).
  */
 #define PRELOAD 6u
 
@@ -24,6 +26,42 @@ void TKLtimer_init(void) {
     TCNT0 = PRELOAD; /* Preload timer */
 }
 
+void TKLtimer_idle(void) {
+    set_sleep_mode(SLEEP_MODE_IDLE); /* Timer0 keeps running in idle mode */
+    sleep_enable();
+    TKLINT_ENA(); /* `sei` delays ISRs until after next instruction */
+    sleep_cpu();
+    sleep_disable();
+}
+
+uint32_t TKLtimer_getTs(void) {
+    TKLint_status_t intStatus;
+
+    TKLINT_SAVE_DIS(intStatus); /* Tick count and timer count must match */
+    TKLtyp_tick_t tickCnt = TKLtick_getTick();
+    const uint8_t timerCnt = TCNT0;
+    uint8_t subTickCnt = 0u;
+
+    /* Overflow pending (ISR not run yet)?  Timer then counts from `0`
+       instead of preload value.  If timer count was read right before the
+       overflow, it is still valid. */
+    if ((0u != (TIFR0 & (1u<<TOV0))) && (UINT8_MAX > timerCnt)) {
+        tickCnt++;
+        subTickCnt = timerCnt;
+    } else if (PRELOAD <= timerCnt) {
+        subTickCnt = (uint8_t)(timerCnt - PRELOAD);
+    } else {
+        /* Do nothing (ISR about to preload timer; `0`) */
+    }
+    TKLINT_RESTORE(intStatus);
+
+    if (TKLTIMER_TS_PER_TICK <= subTickCnt) { /* Late ISR?  Do not overtake */
+        subTickCnt = TKLTIMER_TS_PER_TICK - 1u;
+    }
+
+    return ((uint32_t)tickCnt * TKLTIMER_TS_PER_TICK + subTickCnt);
+}
+
 /**
  * \brief Relative system time tick ISR
  *
@@ -6,6 +6,7 @@
 #include <stdint.h>
 
 #include <avr/io.h> /* Provides easy AVR MCU register access */
+#include <avr/sleep.h> /* Provides AVR MCU sleep mode access */
 
 #include "TKLtick.h"
 
@@ -21,6 +22,19 @@
 #define TKLTIMER_1S 1000u
 /** \} */
 
+/**
+ * \brief Time stamp units (Timer0 counts) per time tick (see
+ * \ref TKLtimer_getTs())
+ */
+#define TKLTIMER_TS_PER_TICK 250u
+
+/**
+ * \brief Conversion: time stamp to time
+ *
+ * `1 time stamp unit = 64 / 16e6 Hz = 4e-6 s => 4000 ns`
+ */
+#define TKLTIMER_TS_NS 4000u
+
 /* OPERATIONS
  * ==========
  */
@@ -28,4 +42,30 @@
 /** \brief Initialize Arduino Uno’s Timer0 */
 void TKLtimer_init(void);
 
+/**
+ * \brief Enable interrupts and put MCU to sleep until next interrupt
+ *
+ * Must be called with interrupts disabled.  Enabling the interrupts and
+ * entering sleep mode happens atomically, so no wake-up interrupt is missed.
+ * Returns with interrupts enabled.
+ */
+void TKLtimer_idle(void);
+
+/**
+ * \brief Get high-resolution time stamp
+ *
+ * Combines the relative system time tick count with the current Timer0 count,
+ * i.e. `tick * TKLTIMER_TS_PER_TICK + timer0Cnt` (see \ref TKLTIMER_TS_NS).
+ * Can be registered with the Taskuler scheduler via `TKLsdlr_setTsSrc()` to
+ * measure task execution times with sub-tick resolution.  Takes a pending
+ * Timer0 overflow into account, so time stamps are monotonic also while
+ * interrupts are disabled (for less than one time tick).
+ *
+ * Wraps at `UINT32_MAX` (seamlessly on time tick count rollover, except for
+ * 16 bit time ticks; see `TKLSDLRCFG_TICK_WIDTH`).
+ *
+ * \return Current time stamp
+ */
+uint32_t TKLtimer_getTs(void);
+
 #endif /* TKLTIMER_H */
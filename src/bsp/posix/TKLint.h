@@ -0,0 +1,68 @@
+/** \file */
+
+#ifndef TKLINT_H
+#define TKLINT_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <signal.h> /* Provides POSIX signal masking */
+
+/**
+ * \brief Signal that serves as time tick "interrupt"
+ *
+ * Only this signal is masked by the wrapper macros below, so any other signal
+ * of the host OS is not affected.
+ */
+#ifndef TKLINT_SIG
+#define TKLINT_SIG SIGALRM
+#endif /* TKLINT_SIG */
+
+/**
+ * \brief Block/unblock time tick signal for calling thread
+ *
+ * \param how_ `SIG_BLOCK` or `SIG_UNBLOCK`
+ */
+#define TKLINT_SETMASK(how_) \
+    do { \
+        sigset_t set_; \
+        (void)sigemptyset(&set_); \
+        (void)sigaddset(&set_, TKLINT_SIG); \
+        (void)pthread_sigmask((how_), &set_, NULL); \
+    } while (false)
+
+/**
+ * \{
+ * \brief Wrapper to abstract from host-OS-specific statements
+ *
+ * "Interrupts" are the time tick signal (\ref TKLINT_SIG), which is only
+ * delivered to the thread running the Taskuler scheduler.
+ */
+#define TKLINT_ENA() TKLINT_SETMASK(SIG_UNBLOCK)
+#define TKLINT_DIS() TKLINT_SETMASK(SIG_BLOCK)
+/** \} */
+
+/** \brief Saved "interrupt" status (signal mask of calling thread) */
+typedef sigset_t TKLint_status_t;
+
+/**
+ * \{
+ * \brief Wrapper to save "interrupt" status and disable "interrupts", and to
+ * restore saved "interrupt" status
+ *
+ * Unlike \ref TKLINT_ENA(), restoring leaves the time tick signal blocked if
+ * it was already blocked before saving, so critical sections can be nested
+ * and entered from code that runs with "interrupts" disabled.
+ */
+#define TKLINT_SAVE_DIS(status_) \
+    do { \
+        sigset_t set_; \
+        (void)sigemptyset(&set_); \
+        (void)sigaddset(&set_, TKLINT_SIG); \
+        (void)pthread_sigmask(SIG_BLOCK, &set_, &(status_)); \
+    } while (false)
+#define TKLINT_RESTORE(status_) \
+    (void)pthread_sigmask(SIG_SETMASK, &(status_), NULL)
+/** \} */
+
+#endif /* TKLINT_H */
@@ -0,0 +1,375 @@
+/** \file */
+
+#include "TKLmt.h"
+
+/* ATTRIBUTES
+ * ==========
+ */
+
+#if (1u > TKLMT_WRK_CNT) || (64u < TKLMT_WRK_CNT)
+#error "TKLMT_WRK_CNT must be in range [1, 64]"
+#endif /* TKLMT_WRK_CNT */
+
+#if (1u > TKLMT_TSK_CNT_MAX) || (255u < TKLMT_TSK_CNT_MAX)
+#error "TKLMT_TSK_CNT_MAX must be in range [1, 255]"
+#endif /* TKLMT_TSK_CNT_MAX */
+
+/**
+ * \brief Deque of dispatched tasks owned by a worker thread
+ *
+ * Ring buffer of task indices.  Since a task is never dispatched again before
+ * its run has finished, it can never hold more than all tasks.
+ */
+typedef struct {
+    /** \brief Protects deque against concurrent owner and thieves */
+    pthread_mutex_t mtx;
+    /** \brief Task indices */
+    uint8_t tsk[TKLMT_TSK_CNT_MAX];
+    /** \brief Position of front (oldest) task */
+    uint8_t front;
+    /** \brief Number of tasks within deque */
+    uint8_t cnt;
+} deque_t;
+
+/** \brief Pointer to function that provides curr. rel. sys. time tick */
+static TKLtyp_p_getTick_t pv_p_getTick;
+
+/** \brief Registered task list */
+static TKLsdlr_tskLst_t* pv_p_tskLst;
+
+/** \brief Number of tasks within registered task list */
+static uint8_t pv_tskCnt;
+
+/**
+ * \brief Reciprocal of period of each task (see \ref TKLsdlr_calcRelRecip())
+ */
+static TKLtyp_tick_t pv_relRecip[TKLMT_TSK_CNT_MAX];
+
+/** \brief Task deadline overrun counter (atomic access) */
+static uint8_t pv_tskOverrunCnt;
+
+/**
+ * \brief Whether a task is dispatched (queued or running) (atomic access)
+ *
+ * Set by dispatching thread, cleared by worker thread after task run.
+ */
+static uint8_t pv_tskBusy[TKLMT_TSK_CNT_MAX];
+
+/** \brief Deque of each worker thread */
+static deque_t pv_deque[TKLMT_WRK_CNT];
+
+/** \brief Worker thread handles */
+static pthread_t pv_wrkThrd[TKLMT_WRK_CNT];
+
+/** \brief Index of each worker thread (thread argument) */
+static uint8_t pv_wrkIdx[TKLMT_WRK_CNT];
+
+/** \brief Worker thread that receives next dispatched task (round robin) */
+static uint8_t pv_nextWrk;
+
+/**
+ * \brief Number of dispatched but not yet taken tasks (over all deques)
+ *
+ * Each worker thread takes one task per successful wait.
+ */
+static sem_t pv_jobSem;
+
+/** \brief Request for worker threads to terminate (atomic access) */
+static bool pv_isStop;
+
+/**
+ * \brief Protects waiting for \ref pv_idleCond
+ *
+ * Only taken when the number of busy tasks drops to `0` and by
+ * \ref TKLmt_wait(), so that dispatching and finishing a task run do not
+ * contend for it.
+ */
+static pthread_mutex_t pv_idleMtx = PTHREAD_MUTEX_INITIALIZER;
+
+/** \brief Signaled when number of busy tasks drops to `0` */
+static pthread_cond_t pv_idleCond = PTHREAD_COND_INITIALIZER;
+
+/** \brief Number of busy tasks (see \ref pv_tskBusy) (atomic access) */
+static uint8_t pv_busyCnt;
+
+/* OPERATIONS
+ * ==========
+ */
+
+/**
+ * \brief Push task to back of a deque (dispatching thread)
+ *
+ * \param p_deque Deque
+ * \param tsk Task index
+ */
+static void pv_dequePush(deque_t* const p_deque, const uint8_t tsk) {
+    (void)pthread_mutex_lock(&p_deque->mtx);
+    p_deque->tsk[(p_deque->front + p_deque->cnt) % TKLMT_TSK_CNT_MAX] = tsk;
+    p_deque->cnt++;
+    (void)pthread_mutex_unlock(&p_deque->mtx);
+}
+
+/**
+ * \brief Take task from a deque
+ *
+ * The owner takes the newest task from the back (LIFO, still warm in its
+ * cache), thieves take the oldest one from the front (FIFO, waiting longest).
+ *
+ * \param p_deque Deque
+ * \param isOwner `true` if called by the deque’s owner
+ * \param p_tsk Receives task index, if any
+ *
+ * \return `true` if a task was taken, `false` if deque is empty
+ */
+static bool pv_dequeTake(deque_t* const p_deque,
+                         const bool isOwner,
+                         uint8_t* const p_tsk) {
+    bool isTaken = false;
+
+    (void)pthread_mutex_lock(&p_deque->mtx);
+    if (0u < p_deque->cnt) { /* Task available? */
+        p_deque->cnt--;
+        if (true == isOwner) {
+            *p_tsk = p_deque->tsk[(p_deque->front + p_deque->cnt) %
+                                  TKLMT_TSK_CNT_MAX];
+        } else {
+            *p_tsk = p_deque->tsk[p_deque->front];
+            p_deque->front =
+                (uint8_t)((p_deque->front + 1u) % TKLMT_TSK_CNT_MAX);
+        }
+        isTaken = true;
+    }
+    (void)pthread_mutex_unlock(&p_deque->mtx);
+
+    return (isTaken);
+}
+
+/**
+ * \brief Run a dispatched task and check it for deadline overrun (worker
+ * thread)
+ *
+ * \param tsk Index of task to run within task list
+ */
+static void pv_runTsk(const uint8_t tsk) {
+    const TKLsdlr_tskLst_t* const p_tskLst = pv_p_tskLst;
+
+    (*TKLSDLR_TSK_RUNNER(p_tskLst, tsk))(); /* Run periodic task */
+
+    /* Check for task deadline overrun (still correct on time tick rollover) */
+    if ((TKLtyp_tick_t)((*pv_p_getTick)() -
+                        TKLSDLR_TSK_LAST_RUN(p_tskLst, tsk)) >
+        TKLSDLR_TSK_DEADLINE(p_tskLst, tsk)) {
+        uint8_t cnt = __atomic_load_n(&pv_tskOverrunCnt, __ATOMIC_RELAXED);
+
+        /* Incr. deadline overrun counter unless saturated (retry if
+           concurrently changed) */
+        while ((UINT8_MAX > cnt) &&
+               (false == __atomic_compare_exchange_n(&pv_tskOverrunCnt,
+                                                     &cnt,
+                                                     (uint8_t)(cnt + 1u),
+                                                     false,
+                                                     __ATOMIC_RELAXED,
+                                                     __ATOMIC_RELAXED))) {
+            /* Do nothing (retry with updated `cnt`) */
+        }
+
+        /* Run custom deadline overrun hook, if defined */
+        TKLMT_OVERRUN_HOOK(TKLSDLR_TSK_RUNNER(p_tskLst, tsk));
+    }
+
+    /* Release task for next dispatch (publishes changes by task runner) */
+    __atomic_store_n(&pv_tskBusy[tsk], 0u, __ATOMIC_RELEASE);
+
+    /* Last busy task finished?  Signal under mutex, so that the wake-up cannot
+       get lost between a waiter's check and its wait */
+    if (1u == __atomic_fetch_sub(&pv_busyCnt, 1u, __ATOMIC_ACQ_REL)) {
+        (void)pthread_mutex_lock(&pv_idleMtx);
+        (void)pthread_cond_broadcast(&pv_idleCond);
+        (void)pthread_mutex_unlock(&pv_idleMtx);
+    }
+}
+
+/**
+ * \brief Worker thread: take dispatched tasks from own deque or steal them
+ * from other deques, and run them
+ *
+ * \param p_arg Pointer to index of worker thread
+ *
+ * \return `NULL` once termination is requested
+ */
+static void* pv_wrkThrdRunner(void* p_arg) {
+    const uint8_t wrk = *(const uint8_t*)p_arg;
+
+    while (true) {
+        /* Wait for a dispatched task (or termination request) */
+        while ((0 != sem_wait(&pv_jobSem)) && (EINTR == errno)) {
+            /* Do nothing (retry) */
+        }
+        if (true == __atomic_load_n(&pv_isStop, __ATOMIC_ACQUIRE)) {
+            break; /* Only requested with no task dispatched */
+        }
+
+        /* A task is guaranteed to be available within some deque (one per
+           successful wait), but might be in flux between deques scanned */
+        uint8_t tsk = 0u;
+        bool isTaken = pv_dequeTake(&pv_deque[wrk], true, &tsk);
+
+        for (uint8_t i = 1u; false == isTaken; i++) {
+            isTaken = pv_dequeTake(&pv_deque[(wrk + i) % TKLMT_WRK_CNT],
+                                   false,
+                                   &tsk);
+        }
+
+        pv_runTsk(tsk);
+    } /* while (true) */
+
+    return (NULL);
+}
+
+#ifdef TEST
+/**
+ * \brief "Invisible" API for unit tests to modify the internal state (private
+ * vars.)
+ *
+ * \param p_getTick Pointer to an access function that provides the current
+ * relative system time tick count
+ * \param p_tskLst Task list
+ * \param tskCnt Number of tasks within provided task list
+ */
+void TKLmt_utModTickSrcTskLst(const TKLtyp_p_getTick_t p_getTick,
+                              TKLsdlr_tskLst_t* const p_tskLst,
+                              const uint8_t tskCnt) {
+    pv_p_getTick = p_getTick;
+    pv_p_tskLst = p_tskLst;
+    pv_tskCnt = tskCnt;
+}
+#endif /* TEST */
+
+void TKLmt_init(void) {
+    sigset_t blockAll;
+    sigset_t maskSave;
+    int ret = 0;
+
+    __atomic_store_n(&pv_isStop, false, __ATOMIC_RELAXED);
+    ret = sem_init(&pv_jobSem, 0, 0u);
+    assert(0 == ret); /* Sanity check (Design by Contract) */
+
+    /* Worker threads inherit signal mask, so they never handle signals */
+    (void)sigfillset(&blockAll);
+    ret = pthread_sigmask(SIG_BLOCK, &blockAll, &maskSave);
+    assert(0 == ret);
+    for (uint8_t i = 0u; TKLMT_WRK_CNT > i; i++) {
+        pv_deque[i].front = 0u;
+        pv_deque[i].cnt = 0u;
+        ret = pthread_mutex_init(&pv_deque[i].mtx, NULL);
+        assert(0 == ret);
+        pv_wrkIdx[i] = i;
+        ret = pthread_create(&pv_wrkThrd[i],
+                             NULL,
+                             &pv_wrkThrdRunner,
+                             &pv_wrkIdx[i]);
+        assert(0 == ret);
+    }
+    (void)pthread_sigmask(SIG_SETMASK, &maskSave, NULL);
+
+    (void)ret; /* Unused if assertions are disabled */
+}
+
+void TKLmt_stop(void) {
+    TKLmt_wait();
+
+    __atomic_store_n(&pv_isStop, true, __ATOMIC_RELEASE);
+    for (uint8_t i = 0u; TKLMT_WRK_CNT > i; i++) {
+        (void)sem_post(&pv_jobSem); /* Wake up each worker thread once */
+    }
+    for (uint8_t i = 0u; TKLMT_WRK_CNT > i; i++) {
+        (void)pthread_join(pv_wrkThrd[i], NULL);
+        (void)pthread_mutex_destroy(&pv_deque[i].mtx);
+    }
+    (void)sem_destroy(&pv_jobSem);
+}
+
+void TKLmt_setTickSrc(const TKLtyp_p_getTick_t p_getTick) {
+    assert(NULL != p_getTick); /* Sanity check (Design by Contract) */
+
+    pv_p_getTick = p_getTick;
+}
+
+void TKLmt_setTskLst(TKLsdlr_tskLst_t* const p_tskLst, const uint8_t tskCnt) {
+    /* Sanity check (Design by Contract) */
+    assert((NULL != p_tskLst) &&
+           (0u < tskCnt));
+#if 255u > TKLMT_TSK_CNT_MAX
+    assert(TKLMT_TSK_CNT_MAX >= tskCnt);
+#endif /* 255u > TKLMT_TSK_CNT_MAX */
+    for (uint8_t i = 0u; tskCnt > i; i++) {
+        assert((0u < TKLSDLR_TSK_PERIOD(p_tskLst, i)) &&
+               (0u < TKLSDLR_TSK_DEADLINE(p_tskLst, i)) &&
+               (NULL != TKLSDLR_TSK_RUNNER(p_tskLst, i)));
+    }
+
+    TKLmt_wait(); /* Tasks of previous task list might still be running */
+
+    pv_p_tskLst = p_tskLst;
+    pv_tskCnt = tskCnt;
+    for (uint8_t i = 0u; tskCnt > i; i++) {
+        pv_relRecip[i] = TKLsdlr_calcRelRecip(TKLSDLR_TSK_PERIOD(p_tskLst, i));
+    }
+}
+
+uint8_t TKLmt_cntTskOverrun(void) {
+    return (__atomic_load_n(&pv_tskOverrunCnt, __ATOMIC_RELAXED));
+}
+
+void TKLmt_clrTskOverrun(void) {
+    __atomic_store_n(&pv_tskOverrunCnt, 0u, __ATOMIC_RELAXED);
+}
+
+uint8_t TKLmt_cntBusy(void) {
+    return (__atomic_load_n(&pv_busyCnt, __ATOMIC_ACQUIRE));
+}
+
+void TKLmt_wait(void) {
+    (void)pthread_mutex_lock(&pv_idleMtx);
+    while (0u < __atomic_load_n(&pv_busyCnt, __ATOMIC_ACQUIRE)) {
+        (void)pthread_cond_wait(&pv_idleCond, &pv_idleMtx);
+    }
+    (void)pthread_mutex_unlock(&pv_idleMtx);
+}
+
+void TKLmt_exec(void) {
+    /* Sanity check (Design by Contract) */
+    assert((NULL != pv_p_getTick) &&
+           (NULL != pv_p_tskLst) &&
+           (0u < pv_tskCnt));
+
+    const TKLtyp_tick_t tickCnt = (*pv_p_getTick)(); /* Get curr. tick count */
+    TKLsdlr_tskLst_t* const p_tskLst = pv_p_tskLst; /* Set ptr. to task list */
+    const uint8_t tskCnt = pv_tskCnt; /* Number of tasks in task list */
+
+    /* Loop through all tasks in task list that are not busy (task list entry
+       is owned by worker thread meanwhile) and dispatch all due tasks */
+    for (uint8_t i = 0u; tskCnt > i; i++) {
+        if ((0u == __atomic_load_n(&pv_tskBusy[i], __ATOMIC_ACQUIRE)) &&
+            ((TKLtyp_tick_t)(tickCnt - TKLSDLR_TSK_LAST_RUN(p_tskLst, i)) >=
+             TKLSDLR_TSK_PERIOD(p_tskLst, i))) {
+            /* Save (ideal) time of when task was "ready-to-run" (same
+               calculation as scheduler) */
+            TKLSDLR_TSK_LAST_RUN(p_tskLst, i) =
+                TKLsdlr_calcRel(TKLSDLR_TSK_PERIOD(p_tskLst, i),
+                                TKLSDLR_TSK_LAST_RUN(p_tskLst, i),
+                                tickCnt,
+                                pv_relRecip[i]);
+
+            if (true == TKLSDLR_TSK_ACTIVE(p_tskLst, i)) { /* Task enabled? */
+                /* Published to worker thread via deque mutex */
+                __atomic_store_n(&pv_tskBusy[i], 1u, __ATOMIC_RELAXED);
+                (void)__atomic_fetch_add(&pv_busyCnt, 1u, __ATOMIC_RELAXED);
+
+                pv_dequePush(&pv_deque[pv_nextWrk], i);
+                pv_nextWrk = (uint8_t)((pv_nextWrk + 1u) % TKLMT_WRK_CNT);
+                (void)sem_post(&pv_jobSem); /* Wake up a worker thread */
+            }
+        } /* if (...) */
+    } /* for (...) */
+}
@@ -0,0 +1,148 @@
+/** \file */
+
+#ifndef TKLMT_H
+#define TKLMT_H
+
+/* Requires POSIX.1-2008 interfaces, i.e. build with
+   `-D_POSIX_C_SOURCE=200809L` (or `-std=gnu99`), and linking with
+   `-pthread` */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <errno.h>
+#include <signal.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include "assert.h" /* For sanity checks (Design by Contract) */
+
+#include "TKLtyp.h"
+#include "TKLsdlr.h" /* Provides time tick query function signature */
+
+/**
+ * \brief Number of worker threads (configurable; must be in range `[1, 64]`)
+ */
+#ifndef TKLMT_WRK_CNT
+#define TKLMT_WRK_CNT 4u
+#endif /* TKLMT_WRK_CNT */
+
+/**
+ * \brief Max. number of tasks within a task list (configurable; must be in
+ * range `[1, 255]`)
+ *
+ * Dimensions the statically allocated per-task and per-worker state.
+ */
+#ifndef TKLMT_TSK_CNT_MAX
+#define TKLMT_TSK_CNT_MAX 255u
+#endif /* TKLMT_TSK_CNT_MAX */
+
+/**
+ * \brief Custom task deadline overrun hook (optional)
+ *
+ * Run on the worker thread that ran the overrunning task, i.e. must be thread
+ * safe.  Empty by default.
+ */
+#ifndef TKLMT_OVERRUN_HOOK
+#define TKLMT_OVERRUN_HOOK(tsk_)
+#endif /* TKLMT_OVERRUN_HOOK */
+
+/* OPERATIONS
+ * ==========
+ */
+
+/**
+ * \brief Start worker threads
+ *
+ * Worker threads are created with all signals blocked, so that signals of the
+ * host OS (e.g., the time tick signal \ref TKLINT_SIG) are never handled by
+ * them.  Failing to create the synchronization objects or worker threads
+ * (e.g., for lack of resources of the host OS) fires an assert, since
+ * dispatched tasks would never run and waiting for them would block forever
+ * otherwise.
+ */
+void TKLmt_init(void);
+
+/**
+ * \brief Stop worker threads
+ *
+ * Waits for all dispatched task runs to finish (see \ref TKLmt_wait()) before
+ * worker threads are terminated.  \ref TKLmt_init() may be called again
+ * afterwards.
+ */
+void TKLmt_stop(void);
+
+/**
+ * \brief Register relative system time tick with executor
+ *
+ * \param p_getTick Pointer to an access function that provides the current
+ * relative system time tick count.  It is called from the dispatching thread
+ * and from all worker threads concurrently, i.e. must be thread safe (e.g.,
+ * `TKLtimer_getMonoTick()`).
+ */
+void TKLmt_setTickSrc(const TKLtyp_p_getTick_t p_getTick);
+
+/**
+ * \brief Register a task list with executor
+ *
+ * Waits for all dispatched task runs (of the previous task list) to finish
+ * first (see \ref TKLmt_wait()).
+ *
+ * \param p_tskLst Task list (same format and layout as for the Taskuler
+ * scheduler, i.e. structure-of-arrays with \ref TKLSDLRCFG_TSK_SOA_ENA; see
+ * \ref TKLSDLR_TSK_LST())
+ * \param tskCnt Number of tasks within provided task list
+ */
+void TKLmt_setTskLst(TKLsdlr_tskLst_t* const p_tskLst, const uint8_t tskCnt);
+
+/**
+ * \brief Get number of task deadline overruns
+ *
+ * \return Number of task deadline overruns (saturates at `UINT8_MAX`)
+ */
+uint8_t TKLmt_cntTskOverrun(void);
+
+/** \brief Reset task deadline overrun counter */
+void TKLmt_clrTskOverrun(void);
+
+/**
+ * \brief Get number of dispatched task runs that have not finished yet
+ *
+ * \return Number of tasks that are queued or running on a worker thread
+ */
+uint8_t TKLmt_cntBusy(void);
+
+/** \brief Wait until all dispatched task runs have finished */
+void TKLmt_wait(void);
+
+/**
+ * \brief Dispatching algorithm execution cycle
+ *
+ * Multi-threaded counterpart to \ref TKLsdlr_exec(), to be called from within
+ * the main endless "super loop" of one (dispatching) thread.  Task releases
+ * are the same:  A task is due to run once its period has elapsed since its
+ * last run, `lastRun` is set to the ideal release time (catching up on lost
+ * time ticks, via \ref TKLsdlr_calcRel() like the scheduler), disabled tasks
+ * are not run but still get their `lastRun` updated.
+ *
+ * Differences are:
+ * * All due tasks of a cycle are dispatched (in task list order) to the worker
+ *   threads and run in parallel, instead of only the first one.
+ * * A task is never run on more than one worker thread at a time.  If it is
+ *   still queued or running when due again, its release is deferred to the
+ *   first cycle after its run has finished (with `lastRun` alignment as
+ *   usual, so missed releases are skipped).
+ *
+ * Each worker thread owns a deque of dispatched tasks, to which due tasks are
+ * distributed round robin.  Workers run tasks from the back of their own deque
+ * and, once it is empty, steal from the front of other workers’ deques, so
+ * that load is balanced also for uneven task execution times.
+ *
+ * Deadline overrun detection (end of task run vs. `lastRun` + `deadline`) is
+ * done on the worker thread right after the task run.
+ *
+ * Task attributes must only be changed from the dispatching thread (e.g.,
+ * from within the super loop) or by the task’s own task runner (e.g., to
+ * deactivate a one-shot task).
+ */
+void TKLmt_exec(void);
+
+#endif /* TKLMT_H */
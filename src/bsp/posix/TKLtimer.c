@@ -0,0 +1,180 @@
+/** \file */
+
+#include "TKLtimer.h"
+
+/* ATTRIBUTES
+ * ==========
+ */
+
+/** \brief Nanoseconds per second */
+#define NS_PER_S 1000000000u
+
+/** \brief Periodic timer (timerfd) that drives the time tick */
+static int pv_timerFd = -1;
+
+/** \brief Thread that runs the Taskuler scheduler (receives tick signal) */
+static pthread_t pv_sdlrThrd;
+
+/** \brief Helper thread that waits for timer expirations */
+static pthread_t pv_timerThrd;
+
+/**
+ * \brief Handshake from tick signal handler to helper thread
+ *
+ * Posted once the signal handler has consumed the timer expirations, so the
+ * helper thread does not flood the scheduler thread with signals.
+ */
+static sem_t pv_tickSem;
+
+/**
+ * \brief Start time of free-running time tick count in ns
+ *
+ * Only accessed from the thread running the Taskuler scheduler.
+ */
+static uint64_t pv_monoEpoch;
+
+/* OPERATIONS
+ * ==========
+ */
+
+/**
+ * \brief Get current `CLOCK_MONOTONIC` time in ns
+ *
+ * \return Current time in ns
+ */
+static uint64_t pv_getMonoNs(void) {
+    struct timespec now;
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return ((uint64_t)now.tv_sec * NS_PER_S + (uint64_t)now.tv_nsec);
+}
+
+/**
+ * \brief Relative system time tick "ISR" (signal handler)
+ *
+ * Provides regular time basis for Taskuler scheduler.
+ *
+ * \param sig Signal number (unused)
+ */
+static void pv_tickIsr(int sig) {
+    const int errnoSave = errno; /* Do not disturb interrupted code */
+    uint64_t expCnt = 0u;
+
+    (void)sig;
+
+    /* Non-blocking; fails if no expiration is pending */
+    if ((ssize_t)sizeof(expCnt) == read(pv_timerFd, &expCnt, sizeof(expCnt))) {
+        for (; 0u < expCnt; expCnt--) {
+            TKLtick_incrTick();
+        }
+    }
+
+    (void)sem_post(&pv_tickSem); /* Async-signal-safe */
+    errno = errnoSave;
+}
+
+/**
+ * \brief Helper thread: forward timer expirations as tick signal to the
+ * scheduler thread
+ *
+ * \param p_arg Unused
+ *
+ * \return Never returns
+ */
+static void* pv_timerThrdRunner(void* p_arg) {
+    struct pollfd timerPoll = {.fd = pv_timerFd, .events = POLLIN};
+
+    (void)p_arg;
+
+    while (true) {
+        if (0 < poll(&timerPoll, 1u, -1)) { /* Timer expired? */
+            (void)pthread_kill(pv_sdlrThrd, TKLINT_SIG);
+
+            /* Wait until signal handler has consumed expirations */
+            while ((0 != sem_wait(&pv_tickSem)) && (EINTR == errno)) {
+                /* Do nothing (retry) */
+            }
+        }
+    } /* while (true) */
+
+    return (NULL);
+}
+
+void TKLtimer_init(void) {
+    const struct itimerspec timerPeriod = {
+        .it_interval = {.tv_sec = (time_t)(TKLTIMER_TICK_NS / NS_PER_S),
+                        .tv_nsec = (long)(TKLTIMER_TICK_NS % NS_PER_S)},
+        .it_value = {.tv_sec = (time_t)(TKLTIMER_TICK_NS / NS_PER_S),
+                     .tv_nsec = (long)(TKLTIMER_TICK_NS % NS_PER_S)}
+    };
+    struct sigaction tickAct = {.sa_handler = &pv_tickIsr,
+                                .sa_flags = SA_RESTART};
+
+    int ret = 0;
+
+    pv_sdlrThrd = pthread_self();
+    (void)sigemptyset(&tickAct.sa_mask);
+    ret = sigaction(TKLINT_SIG, &tickAct, NULL);
+    assert(0 == ret); /* Sanity check (Design by Contract) */
+    ret = sem_init(&pv_tickSem, 0, 0u);
+    assert(0 == ret);
+
+    pv_timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    assert(0 <= pv_timerFd);
+    ret = timerfd_settime(pv_timerFd, 0, &timerPeriod, NULL);
+    assert(0 == ret);
+
+    /* Helper thread inherits (disabled) "interrupts", so tick signal is only
+       ever handled by scheduler thread */
+    ret = pthread_create(&pv_timerThrd, NULL, &pv_timerThrdRunner, NULL);
+    assert(0 == ret);
+
+    (void)ret; /* Unused if assertions are disabled */
+}
+
+void TKLtimer_idle(void) {
+    sigset_t waitMask;
+
+    (void)pthread_sigmask(SIG_BLOCK, NULL, &waitMask); /* Get current mask */
+    (void)sigdelset(&waitMask, TKLINT_SIG);
+    (void)sigsuspend(&waitMask); /* Atomically unblock and wait for signal */
+    TKLINT_ENA();
+}
+
+TKLtyp_tick_t TKLtimer_getMonoTick(void) {
+    /* Truncation to time tick width is the regular time tick count rollover */
+    return ((TKLtyp_tick_t)((pv_getMonoNs() - pv_monoEpoch) /
+                            TKLTIMER_TICK_NS));
+}
+
+void TKLtimer_clrMonoTick(void) {
+    pv_monoEpoch = pv_getMonoNs();
+}
+
+void TKLtimer_sleepMonoTick(const TKLtyp_tick_t tickCnt) {
+    const uint64_t tickNow = (pv_getMonoNs() - pv_monoEpoch) /
+                             TKLTIMER_TICK_NS;
+    /* Saturate, so that wake-up time does not overflow (and lie in the past),
+       e.g. for `TKLTYP_TICK_MAX` with 64 bit time ticks if no task is
+       enabled */
+    const uint64_t tickMax = (UINT64_MAX - pv_monoEpoch) / TKLTIMER_TICK_NS -
+                             tickNow;
+    const uint64_t tickSleep = ((uint64_t)tickCnt < tickMax) ?
+                               (uint64_t)tickCnt : tickMax;
+    const uint64_t wakeUp = pv_monoEpoch +
+                            (tickNow + tickSleep) * TKLTIMER_TICK_NS;
+    const struct timespec wakeUpTs = {.tv_sec = (time_t)(wakeUp / NS_PER_S),
+                                      .tv_nsec = (long)(wakeUp % NS_PER_S)};
+
+    /* Absolute wake-up time, so time spent in here does not add up */
+    (void)clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeUpTs, NULL);
+}
+
+uint32_t TKLtimer_getTs(void) {
+    struct timespec now;
+    (void)clock_gettime(CLOCK_MONOTONIC_RAW, &now);
+
+    /* Truncation to 32 bit is the regular time stamp rollover */
+    return ((uint32_t)((uint64_t)now.tv_sec * NS_PER_S +
+                       (uint64_t)now.tv_nsec));
+}
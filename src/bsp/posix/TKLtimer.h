@@ -0,0 +1,124 @@
+/** \file */
+
+#ifndef TKLTIMER_H
+#define TKLTIMER_H
+
+/* Requires POSIX.1-2008 interfaces, i.e. build with
+   `-D_POSIX_C_SOURCE=200809L` (or `-std=gnu99`) */
+#include <stdint.h>
+#include <stdbool.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <poll.h>
+#include <pthread.h>
+#include <semaphore.h>
+#include <sys/timerfd.h> /* Linux-specific */
+#include "assert.h" /* For sanity checks (Design by Contract) */
+
+#include "TKLtick.h"
+
+/**
+ * \brief Time tick period in ns (configurable; must be in range
+ * `[1, 4294967295]`)
+ */
+#ifndef TKLTIMER_TICK_NS
+#define TKLTIMER_TICK_NS 1000000u
+#endif /* TKLTIMER_TICK_NS */
+
+/**
+ * \{
+ * \brief Conversion: tick to time
+ *
+ * `1 tick = TKLTIMER_TICK_NS ns` (default: `1e-3 s => 1e3 = 1 s`)  
+ * Mind max. value of data type and that conversions to time spans shorter than
+ * the time tick period result in `0`!
+ */
+#define TKLTIMER_0S 0u
+#define TKLTIMER_1MS (1000000u / TKLTIMER_TICK_NS)
+#define TKLTIMER_1S (1000000000u / TKLTIMER_TICK_NS)
+/** \} */
+
+/**
+ * \brief Conversion: time stamp to time (see \ref TKLtimer_getTs())
+ *
+ * `1 time stamp unit = 1e-9 s => 1 ns`
+ */
+#define TKLTIMER_TS_NS 1u
+
+/* OPERATIONS
+ * ==========
+ */
+
+/**
+ * \brief Initialize timerfd-driven time tick
+ *
+ * Starts a periodic `CLOCK_MONOTONIC` timerfd with the time tick period and a
+ * helper thread that waits for its expirations.  The helper thread signals
+ * (\ref TKLINT_SIG) the calling thread, whose signal handler ("ISR") then
+ * increments the time tick count once per timer expiration (so no time tick is
+ * lost while the signal is blocked).
+ *
+ * Must be called from the thread that runs the Taskuler scheduler, with
+ * "interrupts" disabled (see \ref TKLINT_DIS()).  Failing to set up the
+ * signal handler, timer or helper thread (e.g., for lack of resources of the
+ * host OS) fires an assert, since the time tick would never advance otherwise.
+ */
+void TKLtimer_init(void);
+
+/**
+ * \brief Enable "interrupts" and wait for next signal
+ *
+ * Must be called with "interrupts" disabled.  Unblocking the time tick signal
+ * and waiting happens atomically, so no wake-up signal is missed.  Returns
+ * with "interrupts" enabled.
+ */
+void TKLtimer_idle(void);
+
+/**
+ * \brief Get free-running time tick count derived from `CLOCK_MONOTONIC`
+ *
+ * Alternative time tick source that needs neither timer, helper thread nor
+ * signal (and thus, no initialization).  Can be connected to the Taskuler
+ * scheduler instead of \ref TKLtick_getTick().
+ *
+ * \return Number of time tick periods elapsed since last reset via
+ * \ref TKLtimer_clrMonoTick() (or since an unspecified point in time, if never
+ * reset)
+ */
+TKLtyp_tick_t TKLtimer_getMonoTick(void);
+
+/**
+ * \brief Reset free-running time tick count
+ *
+ * See \ref TKLtick_clrTick() for rationale.
+ */
+void TKLtimer_clrMonoTick(void);
+
+/**
+ * \brief Sleep until a number of free-running time ticks has elapsed
+ *
+ * Sleeps until the start of the time tick `TKLtimer_getMonoTick() + tickCnt`,
+ * i.e. it does not drift.  Returns early if interrupted by a signal.  Intended
+ * to be used as the Taskuler scheduler’s idle hook together with
+ * \ref TKLtimer_getMonoTick(), e.g.:
+ * `#define TKLSDLRCFG_IDLE_HOOK(tick_) TKLtimer_sleepMonoTick(tick_)`
+ *
+ * \param tickCnt Max. number of time ticks to sleep
+ */
+void TKLtimer_sleepMonoTick(const TKLtyp_tick_t tickCnt);
+
+/**
+ * \brief Get high-resolution time stamp derived from `CLOCK_MONOTONIC_RAW`
+ * (Linux-specific)
+ *
+ * Not subject to NTP slewing, so suited for execution time measurements.  Can
+ * be registered with the Taskuler scheduler via `TKLsdlr_setTsSrc()` to
+ * measure task execution times with sub-tick resolution.
+ *
+ * \return Current time stamp in ns (wraps at `UINT32_MAX`, i.e. after about
+ * 4.3 s)
+ */
+uint32_t TKLtimer_getTs(void);
+
+#endif /* TKLTIMER_H */
@@ -0,0 +1,26 @@
+/** \file */
+
+#ifndef TKLCS1CFG_H
+#define TKLCS1CFG_H
+
+#include <stdint.h>
+
+/**
+ * \brief Simulated interrupt status register (`1` if interrupts are enabled);
+ * defined by unit test
+ */
+extern volatile uint8_t TKLcs1Cfg_utIntReg;
+
+/** \brief Interrupt register type/size of simulated MCU */
+typedef uint8_t TKLcs1Cfg_intReg_t;
+
+/** \brief Current interrupt status register */
+#define TKLCS1CFG_GET_INT_STATUS TKLcs1Cfg_utIntReg
+
+/** \brief Deactivate (disable/mask/block) interrupts */
+#define TKLCS1CFG_DIS_INT TKLcs1Cfg_utIntReg = 0u
+
+/** \brief Interrupt activation (enable/unmask/unblock) register */
+#define TKLCS1CFG_ENA_INT_REG TKLcs1Cfg_utIntReg
+
+#endif /* TKLCS1CFG_H */
@@ -5,12 +5,349 @@
 
 /* `#include` interfaces */
 //#include /* >ADD HEADER(S) HERE< */
+#include "TKLtsk.h" /* Provides hook function mocks */
 
 /**
  * \brief Custom task deadline overrun hook (optional)
  *
  * Empty if unused (but must be defined).
+ * With per-task deadline overrun recording, the overrunning task’s record is
+ * already updated when the hook is run (see
+ * \ref TKLsdlr_getLastOverrunTsk()).
  */
 #define TKLSDLRCFG_OVERRUN_HOOK(tsk_) /* >ADD CODE HERE (OPTIONAL)< */
 
+/**
+ * \brief Custom idle hook (optional)
+ *
+ * Run at the end of each scheduling algorithm execution cycle in which no task
+ * was run, with the number of time ticks until the next task release as
+ * argument (see \ref TKLsdlr_cntTickToNextRel()).  Typically used to put the
+ * MCU to sleep until then.  As interrupts are still enabled when the argument
+ * is computed, a hook that sleeps must query it again with interrupts
+ * disabled right before sleeping (e.g., via
+ * `TKLtick_sleep(&TKLsdlr_cntTickToNextRel)`, ignoring `tick_`).
+ *
+ * Leave undefined if unused (then, there is no overhead at all).
+ */
+#if TKLSDLRCFG_UT_IDLE_HOOK_ENA
+#define TKLSDLRCFG_IDLE_HOOK(tick_) TKLtsk_idleHook(tick_)
+#endif /* TKLSDLRCFG_UT_IDLE_HOOK_ENA */
+
+/**
+ * \brief Width of relative system time tick count in bits (optional)
+ *
+ * Must be `16`, `32` or `64`; defines \ref TKLtyp_tick_t used for all time
+ * tick counts, task periods, deadlines etc. by the scheduler and by the time
+ * tick BSP.  `16` saves RAM and cycles on 8 bit MCUs, but limits periods and
+ * deadlines accordingly.  `64` makes the time tick count practically never
+ * roll over, e.g. with µs time ticks on 64 bit hosts.  Defaults to `32`.
+ */
+#ifndef TKLSDLRCFG_TICK_WIDTH
+#define TKLSDLRCFG_TICK_WIDTH 32
+#endif /* TKLSDLRCFG_TICK_WIDTH */
+
+/**
+ * \brief Max. number of tasks within a task list (only used with optional
+ * features that keep per-task state, see below)
+ *
+ * Dimensions the statically allocated per-task state.  Must be in range
+ * `[1, 255]`.
+ */
+#define TKLSDLRCFG_TSK_CNT_MAX 16u
+
+/**
+ * \brief Use next-due-time priority queue scheduler engine (optional)
+ *
+ * If `1`, the scheduler keeps all tasks in an index ordered by their next
+ * release tick instead of scanning the whole task list in every execution
+ * cycle.  An execution cycle then costs O(1) if no task is due and O(log n)
+ * per released task.  If `0` (or undefined), the plain task list scan is used.
+ */
+#ifndef TKLSDLRCFG_PQ_ENA
+#define TKLSDLRCFG_PQ_ENA 0
+#endif /* TKLSDLRCFG_PQ_ENA */
+
+/**
+ * \brief Use earliest-deadline-first (EDF) scheduling policy (optional)
+ *
+ * If `1`, \ref TKLsdlr_exec() runs the due-to-run task with the earliest
+ * absolute deadline (`lastRun + period + deadline` of its pending release;
+ * for sporadic tasks, the handling execution cycle plus deadline) instead of
+ * the first one in task list order.  Ties are broken by task list order.
+ * Non-preemptive EDF allows for higher CPU loads than fixed priorities (see
+ * `util/dms-sched-cpu-load.py`), but every execution cycle then considers all
+ * due-to-run tasks.  Absolute deadlines of due-to-run tasks must be less than
+ * half the time tick count range apart.  Works with both the task list scan
+ * and the priority queue engine; \ref TKLsdlr_execTbl() keeps task list
+ * order.
+ */
+#ifndef TKLSDLRCFG_EDF_ENA
+#define TKLSDLRCFG_EDF_ENA 0
+#endif /* TKLSDLRCFG_EDF_ENA */
+
+/**
+ * \brief Dispatch tasks in deadline-monotonic order (optional)
+ *
+ * If `1`, \ref TKLsdlr_setTskLst() sorts the task list by deadline into a
+ * dispatch order (stable, i.e. tasks with equal deadlines keep their order
+ * within the task list, same as the sort of `util/dms-sched-cpu-load.py`),
+ * without moving the tasks themselves.  \ref TKLsdlr_exec() then gives
+ * priority to tasks (and events) in dispatch order instead of task list
+ * order.  How the dispatch order differs from the task list order can be
+ * queried via \ref TKLsdlr_cntTskMisorder() and \ref TKLsdlr_getDispTsk().
+ * Costs some RAM per task (see \ref TKLSDLRCFG_TSK_CNT_MAX).  Not supported
+ * with the EDF scheduling policy or the active task bitmap;
+ * \ref TKLsdlr_execTbl() keeps task list order.
+ */
+#ifndef TKLSDLRCFG_DM_ORDER_ENA
+#define TKLSDLRCFG_DM_ORDER_ENA 0
+#endif /* TKLSDLRCFG_DM_ORDER_ENA */
+
+/**
+ * \brief Provide double-buffered task list switching (mode change) at run
+ * time (optional)
+ *
+ * If `1`, \ref TKLsdlr_reqTskLst() is available.  A requested task list is
+ * switched to by \ref TKLsdlr_exec() at the start of a cycle (optionally only
+ * at a hyperperiod boundary), with the phase of tasks shared between both
+ * task lists carried over and without a burst of releases.
+ */
+#ifndef TKLSDLRCFG_MODE_CHG_ENA
+#define TKLSDLRCFG_MODE_CHG_ENA 0
+#endif /* TKLSDLRCFG_MODE_CHG_ENA */
+
+/**
+ * \brief Provide static cyclic schedule (release table) execution mode
+ * (optional)
+ *
+ * If `1`, \ref TKLsdlr_setRelTbl() and \ref TKLsdlr_execTbl() are available.
+ * Task lists are then limited to 32 tasks.
+ */
+#ifndef TKLSDLRCFG_RELTBL_ENA
+#define TKLSDLRCFG_RELTBL_ENA 0
+#endif /* TKLSDLRCFG_RELTBL_ENA */
+
+/**
+ * \brief Record per-task execution statistics (optional)
+ *
+ * If `1`, min., max. and mean execution time, response time and release
+ * jitter of each task are recorded and available via
+ * \ref TKLsdlr_getTskStat().  Costs some RAM per task
+ * (see \ref TKLSDLRCFG_TSK_CNT_MAX) and a few additions/comparisons per run
+ * task, but no additional time tick query.
+ */
+#ifndef TKLSDLRCFG_STAT_ENA
+#define TKLSDLRCFG_STAT_ENA 0
+#endif /* TKLSDLRCFG_STAT_ENA */
+
+/**
+ * \brief Record task deadline overruns per task (optional)
+ *
+ * If `1`, number of overruns, time of most recent overrun and worst lateness
+ * of each task are recorded and available via \ref TKLsdlr_getTskOverrun()
+ * (in addition to the aggregate \ref TKLsdlr_cntTskOverrun()).  Costs some
+ * RAM per task (see \ref TKLSDLRCFG_TSK_CNT_MAX), but nothing unless a task
+ * overruns.
+ */
+#ifndef TKLSDLRCFG_TSK_OVERRUN_ENA
+#define TKLSDLRCFG_TSK_OVERRUN_ENA 0
+#endif /* TKLSDLRCFG_TSK_OVERRUN_ENA */
+
+/**
+ * \brief Width in bits of per-task deadline overrun counters (only used with
+ * per-task deadline overrun recording)
+ *
+ * Must be `8`, `16` or `32`.  Counters saturate at their max. value.
+ */
+#ifndef TKLSDLRCFG_TSK_OVERRUN_CNT_WIDTH
+#define TKLSDLRCFG_TSK_OVERRUN_CNT_WIDTH 16
+#endif /* TKLSDLRCFG_TSK_OVERRUN_CNT_WIDTH */
+
+/**
+ * \brief Measure task execution times with high-resolution time stamps
+ * (optional, only used with execution statistics or per-task deadline overrun
+ * recording)
+ *
+ * If `1`, a time stamp source with sub-tick resolution can be registered via
+ * \ref TKLsdlr_setTsSrc() (e.g., `TKLtimer_getTs()` of the BSP).  It is read
+ * right before and after each task run, and the resulting execution time (in
+ * time stamp units) is additionally recorded in the execution statistics and
+ * deadline overrun records.  Costs two time stamp queries per run task.
+ */
+#ifndef TKLSDLRCFG_TS_ENA
+#define TKLSDLRCFG_TS_ENA 0
+#endif /* TKLSDLRCFG_TS_ENA */
+
+/**
+ * \brief Record scheduling events into trace ring buffer (optional)
+ *
+ * If `1`, task release, start, end, deadline overrun and enable/disable events
+ * are recorded and can be fetched via \ref TKLsdlr_getTraceEvt() (e.g., to be
+ * dumped and converted via `util/trace-to-chrome.py`).
+ */
+#ifndef TKLSDLRCFG_TRACE_ENA
+#define TKLSDLRCFG_TRACE_ENA 0
+#endif /* TKLSDLRCFG_TRACE_ENA */
+
+/**
+ * \brief Number of events the trace ring buffer can hold (only used with
+ * trace)
+ *
+ * Must be a power of 2 in range `[2, 128]`.
+ */
+#ifndef TKLSDLRCFG_TRACE_BUF_LEN
+#define TKLSDLRCFG_TRACE_BUF_LEN 64u
+#endif /* TKLSDLRCFG_TRACE_BUF_LEN */
+
+/**
+ * \brief Measure CPU load at run time (optional)
+ *
+ * If `1`, the time spent in task runs (busy) vs. the remaining time (idle) is
+ * accounted over a sliding window, in total and per task, and available via
+ * \ref TKLsdlr_getCpuLoad() and \ref TKLsdlr_getTskCpuLoad().  Costs some RAM
+ * per task and sub-window (see \ref TKLSDLRCFG_TSK_CNT_MAX).
+ */
+#ifndef TKLSDLRCFG_LOAD_ENA
+#define TKLSDLRCFG_LOAD_ENA 0
+#endif /* TKLSDLRCFG_LOAD_ENA */
+
+/**
+ * \brief Length of CPU load measurement window in time ticks (only used with
+ * CPU load measurement)
+ *
+ * Should be a multiple of the task list’s hyperperiod for stable results.
+ */
+#ifndef TKLSDLRCFG_LOAD_WIN
+#define TKLSDLRCFG_LOAD_WIN 1000u
+#endif /* TKLSDLRCFG_LOAD_WIN */
+
+/**
+ * \brief Number of sub-windows the CPU load measurement window slides by
+ * (only used with CPU load measurement)
+ *
+ * Must divide \ref TKLSDLRCFG_LOAD_WIN and be in range `[1, 254]`.  More
+ * sub-windows give a smoother result at the cost of RAM.
+ */
+#ifndef TKLSDLRCFG_LOAD_SUBWIN_CNT
+#define TKLSDLRCFG_LOAD_SUBWIN_CNT 4u
+#endif /* TKLSDLRCFG_LOAD_SUBWIN_CNT */
+
+/**
+ * \brief Manage overload by shedding tasks of low criticality (optional)
+ *
+ * If `1`, each task has a criticality level (see \ref TKLsdlr_setTskCrit()).
+ * Deadline overruns are counted per window; on
+ * \ref TKLSDLRCFG_OVLD_OVERRUN_MAX overruns within a window, the overload
+ * level (see \ref TKLsdlr_getOvldLvl()) is raised by one, and after a window
+ * without any overrun, it is lowered by one again.  Tasks whose criticality
+ * is below the overload level are shed (see \ref TKLSDLRCFG_OVLD_STRETCH),
+ * tasks of the highest criticality within the task list never are.  Costs
+ * some RAM per task (see \ref TKLSDLRCFG_TSK_CNT_MAX).
+ */
+#ifndef TKLSDLRCFG_OVLD_ENA
+#define TKLSDLRCFG_OVLD_ENA 0
+#endif /* TKLSDLRCFG_OVLD_ENA */
+
+/**
+ * \brief Length of overload detection window in time ticks (only used with
+ * overload management)
+ */
+#ifndef TKLSDLRCFG_OVLD_WIN
+#define TKLSDLRCFG_OVLD_WIN 1000u
+#endif /* TKLSDLRCFG_OVLD_WIN */
+
+/**
+ * \brief Number of deadline overruns within a window that raise the overload
+ * level (only used with overload management)
+ *
+ * Must be in range `[1, 255]`.
+ */
+#ifndef TKLSDLRCFG_OVLD_OVERRUN_MAX
+#define TKLSDLRCFG_OVLD_OVERRUN_MAX 3u
+#endif /* TKLSDLRCFG_OVLD_OVERRUN_MAX */
+
+/**
+ * \brief How shed tasks are treated (only used with overload management)
+ *
+ * If `0`, shed tasks are not run at all (as if disabled).  Otherwise, they
+ * are only run on every `TKLSDLRCFG_OVLD_STRETCH`th release, i.e. their
+ * periods are stretched by this factor.  Must be in range `[0, 255]`.
+ */
+#ifndef TKLSDLRCFG_OVLD_STRETCH
+#define TKLSDLRCFG_OVLD_STRETCH 0u
+#endif /* TKLSDLRCFG_OVLD_STRETCH */
+
+/**
+ * \brief Provide event-driven sporadic tasks (optional)
+ *
+ * If `1`, tasks with a `period` of `0` are sporadic, i.e. only released by
+ * events posted via \ref TKLsdlr_postEvt() (e.g., from within ISRs).
+ * Sporadic tasks must be among the first 32 tasks of a task list.  Not
+ * supported by the static cyclic schedule (release table) execution mode.
+ */
+#ifndef TKLSDLRCFG_EVT_ENA
+#define TKLSDLRCFG_EVT_ENA 0
+#endif /* TKLSDLRCFG_EVT_ENA */
+
+/**
+ * \brief Provide task chains (optional)
+ *
+ * If `1`, \ref TKLsdlr_setChainTbl() is available.  Consumers of a chain are
+ * sporadic tasks that are run back-to-back right after their producers, so
+ * that a chain adds no scheduling latency per stage.  End-to-end latencies
+ * of chains are checked against their deadlines (see
+ * \ref TKLsdlr_getChainLat()).  Requires event-driven sporadic tasks; not
+ * supported with the active task bitmap.
+ */
+#ifndef TKLSDLRCFG_CHAIN_ENA
+#define TKLSDLRCFG_CHAIN_ENA 0
+#endif /* TKLSDLRCFG_CHAIN_ENA */
+
+/**
+ * \brief Keep active task bitmap (optional)
+ *
+ * If `1`, the task list scan only visits enabled tasks, found via bit
+ * operations on a bitmap that \ref TKLsdlr_setTskAct() keeps up to date, so
+ * disabled tasks cost (next to) nothing.  Their `lastRun` time is not updated
+ * while disabled, but caught up on re-activation (bit-exactly the same as
+ * without bitmap).  Tasks must then only be (de)activated via
+ * \ref TKLsdlr_setTskAct().  Not supported with the priority queue engine or
+ * the static cyclic schedule (release table) execution mode.
+ */
+#ifndef TKLSDLRCFG_ACT_MAP_ENA
+#define TKLSDLRCFG_ACT_MAP_ENA 0
+#endif /* TKLSDLRCFG_ACT_MAP_ENA */
+
+/**
+ * \brief Division-free release time catch-up for all periods (optional)
+ *
+ * When a task is released after more than one of its periods has elapsed
+ * (lost time ticks), its ideal release time needs a remainder of a 32 bit
+ * division by its period, which is expensive on MCUs without hardware
+ * divider (e.g., AVR).  If `1`, power of 2 periods are handled via bit mask
+ * and all other periods via a reciprocal precomputed by
+ * \ref TKLsdlr_setTskLst() (one 32x32 bit multiplication instead).  Costs
+ * some RAM per task (see \ref TKLSDLRCFG_TSK_CNT_MAX).  Releases without lost
+ * time ticks never need a division.
+ */
+#ifndef TKLSDLRCFG_REL_RECIP_ENA
+#define TKLSDLRCFG_REL_RECIP_ENA 0
+#endif /* TKLSDLRCFG_REL_RECIP_ENA */
+
+/**
+ * \brief Structure-of-arrays (hot/cold split) task list layout (optional)
+ *
+ * If `1`, task lists are \ref TKLtyp_tskLstSoa_t instead of arrays of
+ * \ref TKLtyp_tsk_t:  The scan over all tasks only touches the compact hot
+ * array (period, last run) and the activation status array, while deadline
+ * and task runner are only fetched on dispatch.  This avoids padding and
+ * makes the scan cache friendlier with large task lists.  Task lists defined
+ * via \ref TKLSDLR_TSK_LST_DEF() and accessed via the `TKLSDLR_TSK_...()`
+ * macros compile with either layout.
+ */
+#ifndef TKLSDLRCFG_TSK_SOA_ENA
+#define TKLSDLRCFG_TSK_SOA_ENA 0
+#endif /* TKLSDLRCFG_TSK_SOA_ENA */
+
 #endif /* TKLSDLRCFG_H */
@@ -0,0 +1,146 @@
+/** \file */
+
+#ifndef TKLSDLRUTTICKROLLOVER_H
+#define TKLSDLRUTTICKROLLOVER_H
+
+/*
+ * Time tick count rollover test bodies shared by the unit test files of each
+ * time tick width (`TKLSDLRCFG_TICK_WIDTH`).  All time tick values are
+ * relative to \ref TKLTYP_TICK_MAX, so that the same bodies cover each width.
+ * Each test file wraps them into its own (runner-visible) test functions and
+ * must include `unity.h`, `TKLsdlr.h`, `mock_TKLtick.h` and `mock_TKLtsk.h`
+ * before this file.
+ */
+
+/* OPERATIONS
+ * ==========
+ */
+
+/**
+ * \brief Test if multiple task deadline overruns are detected and counts
+ * returned correctly on relative system time tick count rollover
+ */
+static void pv_detectAndCntMultiTskOverrunOnTickRollover(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* Released at `-10`, `90` and `190` */
+        {.active = true,
+         .period = 100u,
+         .deadline = 100u,
+         .lastRun = (TKLtyp_tick_t)(TKLTYP_TICK_MAX - 109u), /* `-110` */
+         .p_tskRunner = &TKLtsk_runner}
+    };
+    const uint8_t overrunExp = 2u;
+
+    /* Task overrun (at rollover) */
+    TKLtick_getTick_ExpectAndReturn((TKLtyp_tick_t)(TKLTYP_TICK_MAX - 9u));
+    TKLtsk_runner_Expect();
+    TKLtick_getTick_ExpectAndReturn(100u);
+
+    /* No task overrun */
+    TKLtick_getTick_ExpectAndReturn(90u);
+    TKLtsk_runner_Expect();
+    TKLtick_getTick_ExpectAndReturn(100u);
+
+    /* Task overrun */
+    TKLtick_getTick_ExpectAndReturn(190u);
+    TKLtsk_runner_Expect();
+    TKLtick_getTick_ExpectAndReturn(291u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 1u);
+    for (uint8_t i = 0u; i < 3; i++) {
+        TKLsdlr_exec();
+    }
+
+    TEST_ASSERT_EQUAL_UINT8(overrunExp, TKLsdlr_cntTskOverrun());
+}
+
+/**
+ * \brief Test if single task deadline overrun is detected and count returned
+ * on inconvenient relative system time tick count rollover
+ *
+ * Special "task deadline overrun at time tick rollover" use case scenario.
+ * This is an important edge case as it made a previously implemented detailed
+ * design solution fail.
+ */
+static void pv_detectAndCntSingleTskOverrunOnInconvTickRollover(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 100u,
+         .deadline = 100u,
+         .lastRun = (TKLtyp_tick_t)(TKLTYP_TICK_MAX - 200u), /* `-201` */
+         .p_tskRunner = &TKLtsk_runner}
+    };
+    const uint8_t overrunExp = 1u;
+
+    /* Task overrun (at rollover) */
+    TKLtick_getTick_ExpectAndReturn((TKLtyp_tick_t)(TKLTYP_TICK_MAX - 10u));
+    TKLtsk_runner_Expect();
+    TKLtick_getTick_ExpectAndReturn(10u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 1u);
+    TKLsdlr_exec();
+
+    TEST_ASSERT_EQUAL_UINT8(overrunExp, TKLsdlr_cntTskOverrun());
+}
+
+/**
+ * \brief Test correct execution of due-to-run task at 3 time ticks period with
+ * relative system time tick count rollover
+ *
+ * `TKLTYP_TICK_MAX - 3` (`-4`) is a multiple of the period for each time tick
+ * width, so that the first release is at the first scheduler execution cycle.
+ */
+static void pv_execDueToRunTskAt3TickPeriodOnTickRollover(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 3u,
+         .deadline = 3u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner}
+    };
+
+    /* Run */
+    TKLtick_getTick_ExpectAndReturn((TKLtyp_tick_t)(TKLTYP_TICK_MAX - 3u));
+    TKLtsk_runner_Expect();
+    TKLtick_getTick_ExpectAndReturn((TKLtyp_tick_t)(TKLTYP_TICK_MAX - 3u));
+
+    /* No run */
+    TKLtick_getTick_ExpectAndReturn((TKLtyp_tick_t)(TKLTYP_TICK_MAX - 2u));
+    TKLtick_getTick_ExpectAndReturn((TKLtyp_tick_t)(TKLTYP_TICK_MAX - 1u));
+
+    /* Run */
+    TKLtick_getTick_ExpectAndReturn(TKLTYP_TICK_MAX);
+    TKLtsk_runner_Expect();
+    TKLtick_getTick_ExpectAndReturn(TKLTYP_TICK_MAX);
+
+    /* No run */
+    TKLtick_getTick_ExpectAndReturn(0u);
+    TKLtick_getTick_ExpectAndReturn(1u);
+
+    /* Run */
+    TKLtick_getTick_ExpectAndReturn(2u);
+    TKLtsk_runner_Expect();
+    TKLtick_getTick_ExpectAndReturn(2u);
+
+    /* No run */
+    TKLtick_getTick_ExpectAndReturn(3u);
+    TKLtick_getTick_ExpectAndReturn(4u);
+
+    /* Run */
+    TKLtick_getTick_ExpectAndReturn(5u);
+    TKLtsk_runner_Expect();
+    TKLtick_getTick_ExpectAndReturn(5u);
+
+    /* No run */
+    TKLtick_getTick_ExpectAndReturn(6u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 1u);
+    for (uint8_t i = 0u; i < 11; i++) {
+        TKLsdlr_exec();
+    }
+}
+
+#endif /* TKLSDLRUTTICKROLLOVER_H */
@@ -5,6 +5,8 @@
 
 #include <stdint.h>
 
+#include "TKLtyp.h" /* Provides time tick type */
+
 /* OPERATIONS
  * ==========
  */
@@ -15,6 +17,14 @@
  *
  * \return Relative system time tick count
  */
-uint32_t TKLtick_getTick(void);
+TKLtyp_tick_t TKLtick_getTick(void);
+
+/**
+ * \brief Function mock to simulate and manipulate MCU’s high-resolution time
+ * stamp source
+ *
+ * \return Time stamp
+ */
+uint32_t TKLtick_getTs(void);
 
 #endif /* TKLTICK_H */
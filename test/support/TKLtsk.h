@@ -3,6 +3,8 @@
 #ifndef TKLTSK_H
 #define TKLTSK_H
 
+#include <stdint.h>
+
 /* OPERATIONS
  * ==========
  */
@@ -17,4 +19,11 @@ void TKLtsk_runner1(void);
 void TKLtsk_runner2(void);
 /** \} */
 
+/**
+ * \brief Function mock to assert expected calls of scheduler’s idle hook
+ *
+ * \param tick Number of time ticks until next task release
+ */
+void TKLtsk_idleHook(const uint32_t tick);
+
 #endif /* TKLTSK_H */
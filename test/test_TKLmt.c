@@ -0,0 +1,394 @@
+/** \file */
+
+#ifdef TEST
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <semaphore.h>
+#include "assert.h" /* Sanity checks (Design by Contract); replaced for unit
+                       testing */
+
+#include "unity.h"
+
+#include "TKLmt.h"
+#include "TKLsdlr.h" /* Release time calculation shared with scheduler */
+
+#include "TKLtyp.h"
+
+/* "Invisible" API for unit tests to modify internal state (private vars.) */
+extern void TKLmt_utModTickSrcTskLst(const TKLtyp_p_getTick_t p_getTick,
+                                     TKLsdlr_tskLst_t* const p_tskLst,
+                                     const uint8_t tskCnt);
+
+/* ATTRIBUTES
+ * ==========
+ */
+
+/**
+ * \brief Time tick count (atomic access)
+ *
+ * Test doubles are used instead of mocks, since they are called from worker
+ * threads concurrently.
+ */
+static TKLtyp_tick_t pv_tick;
+
+/** \brief Number of runs of task runner (atomic access) */
+static uint32_t pv_runCnt;
+
+/** \{ \brief Handshake between test and blocking task runners */
+static sem_t pv_sem0, pv_sem1;
+/** \} */
+
+/** \brief Whether task runners rendezvoused (atomic access) */
+static uint32_t pv_rendezvousCnt;
+
+/* OPERATIONS
+ * ==========
+ */
+
+/**
+ * \brief Thread-safe time tick count query
+ *
+ * \return Time tick count
+ */
+static TKLtyp_tick_t pv_getTick(void) {
+    return (__atomic_load_n(&pv_tick, __ATOMIC_SEQ_CST));
+}
+
+/**
+ * \brief Set time tick count
+ *
+ * \param tick Time tick count
+ */
+static void pv_setTick(const TKLtyp_tick_t tick) {
+    __atomic_store_n(&pv_tick, tick, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * \brief Wait for semaphore for at most 1 s
+ *
+ * \param p_sem Semaphore
+ *
+ * \return `true` if semaphore was taken in time
+ */
+static bool pv_semWait(sem_t* const p_sem) {
+    struct timespec timeout;
+
+    (void)clock_gettime(CLOCK_REALTIME, &timeout);
+    timeout.tv_sec += 1;
+
+    return (0 == sem_timedwait(p_sem, &timeout));
+}
+
+/** \brief Task runner that counts its runs */
+static void pv_tskCount(void) {
+    (void)__atomic_fetch_add(&pv_runCnt, 1u, __ATOMIC_SEQ_CST);
+}
+
+/** \brief Task runner that runs until released by test */
+static void pv_tskBlock(void) {
+    (void)pv_semWait(&pv_sem0);
+    pv_tskCount();
+}
+
+/**
+ * \brief Task runner that signals its start to test and runs until released by
+ * test
+ */
+static void pv_tskBlockSignal(void) {
+    (void)sem_post(&pv_sem1);
+    pv_tskBlock();
+}
+
+/**
+ * \brief Wait for number of busy tasks to drop to a value for at most 1 s
+ *
+ * \param busyCnt Number of busy tasks to wait for
+ *
+ * \return `true` if number of busy tasks dropped to `busyCnt` in time
+ */
+static bool pv_waitBusy(const uint8_t busyCnt) {
+    const struct timespec pollPeriod = {.tv_sec = 0, .tv_nsec = 1000000};
+    uint32_t pollCnt = 0u;
+
+    while ((busyCnt != TKLmt_cntBusy()) && (1000u > pollCnt)) {
+        (void)nanosleep(&pollPeriod, NULL);
+        pollCnt++;
+    }
+
+    return (busyCnt == TKLmt_cntBusy());
+}
+
+/** \brief Task runner that takes 15 time ticks */
+static void pv_tskSlow(void) {
+    pv_setTick(pv_getTick() + 15u);
+}
+
+/**
+ * \{
+ * \brief Task runners that only finish in time if run in parallel
+ */
+static void pv_tskMeet0(void) {
+    (void)sem_post(&pv_sem0);
+    if (true == pv_semWait(&pv_sem1)) {
+        (void)__atomic_fetch_add(&pv_rendezvousCnt, 1u, __ATOMIC_SEQ_CST);
+    }
+}
+
+static void pv_tskMeet1(void) {
+    (void)sem_post(&pv_sem1);
+    if (true == pv_semWait(&pv_sem0)) {
+        (void)__atomic_fetch_add(&pv_rendezvousCnt, 1u, __ATOMIC_SEQ_CST);
+    }
+}
+/** \} */
+
+/** \brief Run before every test */
+void setUp(void) {
+    pv_setTick(0u);
+    __atomic_store_n(&pv_runCnt, 0u, __ATOMIC_SEQ_CST);
+    __atomic_store_n(&pv_rendezvousCnt, 0u, __ATOMIC_SEQ_CST);
+    (void)sem_init(&pv_sem0, 0, 0u);
+    (void)sem_init(&pv_sem1, 0, 0u);
+    TKLmt_init();
+}
+
+/** \brief Run after every test */
+void tearDown(void) {
+    TKLmt_stop();
+    (void)sem_destroy(&pv_sem0);
+    (void)sem_destroy(&pv_sem1);
+
+    /* Reset internal state (private vars.) */
+    TKLmt_utModTickSrcTskLst(NULL, NULL, 0u);
+    TKLmt_clrTskOverrun();
+}
+
+/**
+ * \brief Test that assert fires on attempt to register an invalid task list
+ */
+void test_TKLmt_assertInvalidArgOnSetTskLst(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 0u,
+         .deadline = 1u,
+         .lastRun = 0u,
+         .p_tskRunner = &pv_tskCount}
+    };
+
+    TEST_ASSERT_FAIL_ASSERT(TKLmt_setTskLst(NULL, 1u));
+    TEST_ASSERT_FAIL_ASSERT(TKLmt_setTskLst(tskLst, 0u));
+    TEST_ASSERT_FAIL_ASSERT(TKLmt_setTskLst(tskLst, 1u));
+    TEST_ASSERT_FAIL_ASSERT(TKLmt_exec()); /* No task list registered */
+}
+
+/**
+ * \brief Test that all due and enabled tasks are run once per release, with
+ * ideal `lastRun` alignment
+ */
+void test_TKLmt_execRunAllDueTsk(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &pv_tskCount},
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &pv_tskCount},
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &pv_tskCount},
+        {.active = false,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &pv_tskCount},
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &pv_tskCount},
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &pv_tskCount}
+    };
+
+    TKLmt_setTickSrc(&pv_getTick);
+    TKLmt_setTskLst(tskLst, 6u);
+
+    pv_setTick(9u); /* No task due */
+    TKLmt_exec();
+    TKLmt_wait();
+    TEST_ASSERT_EQUAL_UINT32(0u, pv_runCnt);
+
+    pv_setTick(12u); /* All tasks due */
+    TKLmt_exec();
+    TKLmt_wait();
+    TEST_ASSERT_EQUAL_UINT32(5u, pv_runCnt); /* All but disabled one */
+    for (uint8_t i = 0u; 6u > i; i++) {
+        TEST_ASSERT_EQUAL_UINT32(10u, tskLst[i].lastRun);
+    }
+
+    pv_setTick(19u); /* Already run in this period */
+    TKLmt_exec();
+    TKLmt_wait();
+    TEST_ASSERT_EQUAL_UINT32(5u, pv_runCnt);
+    TEST_ASSERT_EQUAL_UINT8(0u, TKLmt_cntBusy());
+    TEST_ASSERT_EQUAL_UINT8(0u, TKLmt_cntTskOverrun());
+}
+
+/**
+ * \brief Test that a task that is still running when due again is not
+ * dispatched again before its run has finished
+ */
+void test_TKLmt_execNotRunBusyTsk(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 10u,
+         .deadline = 100u,
+         .lastRun = 0u,
+         .p_tskRunner = &pv_tskBlock}
+    };
+
+    TKLmt_setTickSrc(&pv_getTick);
+    TKLmt_setTskLst(tskLst, 1u);
+
+    pv_setTick(10u);
+    TKLmt_exec();
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLmt_cntBusy());
+
+    pv_setTick(20u); /* Due again, but still running */
+    TKLmt_exec();
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLmt_cntBusy());
+    TEST_ASSERT_EQUAL_UINT32(10u, tskLst[0].lastRun);
+
+    (void)sem_post(&pv_sem0); /* Finish run */
+    TKLmt_wait();
+    TEST_ASSERT_EQUAL_UINT32(1u, pv_runCnt);
+
+    pv_setTick(35u); /* Deferred release (missed ones skipped) */
+    TKLmt_exec();
+    TEST_ASSERT_EQUAL_UINT32(30u, tskLst[0].lastRun);
+    (void)sem_post(&pv_sem0);
+    TKLmt_wait();
+    TEST_ASSERT_EQUAL_UINT32(2u, pv_runCnt);
+}
+
+/** \brief Test that task deadline overruns are detected and counted */
+void test_TKLmt_execCntTskOverrun(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 10u,
+         .deadline = 15u,
+         .lastRun = 0u,
+         .p_tskRunner = &pv_tskSlow}
+    };
+    TKLtyp_tsk_t tskLstTight[] = {
+        {.active = true,
+         .period = 10u,
+         .deadline = 14u,
+         .lastRun = 30u,
+         .p_tskRunner = &pv_tskSlow}
+    };
+
+    TKLmt_setTickSrc(&pv_getTick);
+    TKLmt_setTskLst(tskLst, 1u);
+
+    pv_setTick(10u); /* Finishes at `25` (deadline `25`) */
+    TKLmt_exec();
+    TKLmt_wait();
+    TEST_ASSERT_EQUAL_UINT8(0u, TKLmt_cntTskOverrun());
+
+    TKLmt_setTskLst(tskLstTight, 1u);
+
+    pv_setTick(41u); /* Finishes at `56` (deadline `54`) */
+    TKLmt_exec();
+    TKLmt_wait();
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLmt_cntTskOverrun());
+
+    TKLmt_clrTskOverrun();
+    TEST_ASSERT_EQUAL_UINT8(0u, TKLmt_cntTskOverrun());
+}
+
+/**
+ * \brief Test that due tasks are run on different worker threads in parallel
+ */
+void test_TKLmt_execRunInParallel(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &pv_tskMeet0},
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &pv_tskMeet1}
+    };
+
+    TKLmt_setTickSrc(&pv_getTick);
+    TKLmt_setTskLst(tskLst, 2u);
+
+    pv_setTick(10u);
+    TKLmt_exec();
+    TKLmt_wait();
+    TEST_ASSERT_EQUAL_UINT32(2u, pv_rendezvousCnt);
+}
+
+/**
+ * \brief Test that tasks queued in the deque of a worker thread that is
+ * blocked in a task runner are stolen and run by the other worker threads
+ */
+void test_TKLmt_execStealTskOfBlockedWrk(void) {
+#if 1u < TKLMT_WRK_CNT
+    /* Blocking task, then two counting tasks per worker thread (each deque
+       receives two of them round robin, including the blocked worker’s) */
+    TKLtyp_tsk_t tskLst[1u + (2u * TKLMT_WRK_CNT)];
+    const TKLtyp_tsk_t tskBlock = {.active = true,
+                                   .period = 10u,
+                                   .deadline = 100u,
+                                   .lastRun = 0u,
+                                   .p_tskRunner = &pv_tskBlockSignal};
+    const TKLtyp_tsk_t tskCount = {.active = true,
+                                   .period = 10u,
+                                   .deadline = 100u,
+                                   .lastRun = 10u,
+                                   .p_tskRunner = &pv_tskCount};
+
+    (void)memcpy(&tskLst[0], &tskBlock, sizeof(tskBlock));
+    for (uint8_t i = 1u; (1u + (2u * TKLMT_WRK_CNT)) > i; i++) {
+        (void)memcpy(&tskLst[i], &tskCount, sizeof(tskCount));
+    }
+
+    TKLmt_setTickSrc(&pv_getTick);
+    TKLmt_setTskLst(tskLst, (uint8_t)(1u + (2u * TKLMT_WRK_CNT)));
+
+    pv_setTick(10u); /* Only blocking task due */
+    TKLmt_exec();
+    TEST_ASSERT_TRUE(pv_semWait(&pv_sem1)); /* Worker thread blocked */
+
+    pv_setTick(20u); /* All counting tasks due, blocking task still busy */
+    TKLmt_exec();
+    TEST_ASSERT_TRUE(pv_waitBusy(1u));
+    TEST_ASSERT_EQUAL_UINT32(2u * TKLMT_WRK_CNT, pv_runCnt);
+
+    (void)sem_post(&pv_sem0); /* Finish blocking run */
+    TKLmt_wait();
+    TEST_ASSERT_EQUAL_UINT32((2u * TKLMT_WRK_CNT) + 1u, pv_runCnt);
+#else
+    TEST_IGNORE_MESSAGE("Requires more than one worker thread");
+#endif /* 1u < TKLMT_WRK_CNT */
+}
+
+#endif /* TEST */
@@ -0,0 +1,104 @@
+/** \file */
+
+#ifdef TEST
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "assert.h" /* Sanity checks (Design by Contract); replaced for unit
+                       testing */
+
+#include "unity.h"
+
+#include "TKLpool.h"
+
+/* ATTRIBUTES
+ * ==========
+ */
+
+/** \brief Simulated interrupt status register (see `TKLcs1Cfg.h`) */
+volatile uint8_t TKLcs1Cfg_utIntReg;
+
+/** \brief Block of test pool */
+typedef uint32_t pv_blk_t[4];
+
+/** \brief Test pool */
+TKLPOOL_DEF(static, pv_pool, pv_blk_t, 3u);
+
+/* OPERATIONS
+ * ==========
+ */
+
+/** \brief Run before every test */
+void setUp(void) {
+    TKLcs1Cfg_utIntReg = 1u; /* Interrupts enabled */
+}
+
+/** \brief Run after every test */
+void tearDown(void) {
+    /* Reset internal state (private vars.) */
+    pv_pool.freeHead = 0u;
+    pv_pool.initCnt = 3u;
+    pv_pool.useCnt = 0u;
+    TKLpool_clrStat(&pv_pool);
+}
+
+/**
+ * \brief Test that all blocks can be allocated, each once, and that interrupts
+ * are enabled again afterwards
+ */
+void test_TKLpool_alloc(void) {
+    uint32_t* p_blk0 = TKLpool_alloc(&pv_pool);
+    uint32_t* p_blk1 = TKLpool_alloc(&pv_pool);
+    uint32_t* p_blk2 = TKLpool_alloc(&pv_pool);
+
+    TEST_ASSERT_EQUAL_PTR(pv_poolBuf[0], p_blk0);
+    TEST_ASSERT_EQUAL_PTR(pv_poolBuf[1], p_blk1);
+    TEST_ASSERT_EQUAL_PTR(pv_poolBuf[2], p_blk2);
+    TEST_ASSERT_NULL(TKLpool_alloc(&pv_pool));
+    TEST_ASSERT_EQUAL_UINT8(3u, TKLpool_cntUsed(&pv_pool));
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLpool_cntFail(&pv_pool));
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLcs1Cfg_utIntReg);
+}
+
+/**
+ * \brief Test that freed blocks are reused (most recently freed first) and
+ * that blocks not from the pool cannot be freed
+ */
+void test_TKLpool_free(void) {
+    pv_blk_t blk;
+    uint32_t* p_blk0 = TKLpool_alloc(&pv_pool);
+    uint32_t* p_blk1 = TKLpool_alloc(&pv_pool);
+
+    TKLpool_free(&pv_pool, p_blk0);
+    TKLpool_free(&pv_pool, p_blk1);
+
+    TEST_ASSERT_EQUAL_UINT8(0u, TKLpool_cntUsed(&pv_pool));
+    TEST_ASSERT_EQUAL_PTR(p_blk1, TKLpool_alloc(&pv_pool));
+    TEST_ASSERT_EQUAL_PTR(p_blk0, TKLpool_alloc(&pv_pool));
+    TEST_ASSERT_EQUAL_PTR(pv_poolBuf[2], TKLpool_alloc(&pv_pool));
+
+    TEST_ASSERT_FAIL_ASSERT(TKLpool_free(&pv_pool, blk));
+    TEST_ASSERT_FAIL_ASSERT(TKLpool_free(&pv_pool, &p_blk0[1]));
+}
+
+/**
+ * \brief Test that the high-water mark keeps the max. number of allocated
+ * blocks until cleared
+ */
+void test_TKLpool_getUseMax(void) {
+    void* p_blk0 = TKLpool_alloc(&pv_pool);
+    void* p_blk1 = TKLpool_alloc(&pv_pool);
+
+    TKLpool_free(&pv_pool, p_blk1);
+    TKLpool_free(&pv_pool, p_blk0);
+    p_blk0 = TKLpool_alloc(&pv_pool);
+
+    TEST_ASSERT_EQUAL_UINT8(2u, TKLpool_getUseMax(&pv_pool));
+
+    TKLpool_clrStat(&pv_pool);
+
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLpool_getUseMax(&pv_pool));
+}
+
+#endif /* TEST */
@@ -0,0 +1,135 @@
+/** \file */
+
+#ifdef TEST
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "assert.h" /* Sanity checks (Design by Contract); replaced for unit
+                       testing */
+
+#include "unity.h"
+
+#include "TKLq.h"
+
+#include "TKLsdlr.h"
+#include "TKLtyp.h"
+#include "mock_TKLtick.h"
+
+#include "mock_TKLtsk.h"
+
+/* "Invisible" API for unit tests to modify internal state (private vars.) */
+extern void TKLsdlr_utModTickSrcTskLst(const TKLtyp_p_getTick_t p_getTick,
+                                       TKLtyp_tsk_t* const p_tskLst,
+                                       const uint8_t tskCnt);
+
+/* ATTRIBUTES
+ * ==========
+ */
+
+/** \brief Message of test queue */
+typedef struct {
+    uint16_t val;
+    uint8_t seq;
+} pv_msg_t;
+
+/** \brief Test queue */
+TKLQ_DEF(static, pv_q, pv_msg_t, 4u);
+
+/* OPERATIONS
+ * ==========
+ */
+
+/** \brief Run before every test */
+void setUp(void) {
+    /* Do nothing */
+}
+
+/** \brief Run after every test */
+void tearDown(void) {
+    /* Reset internal state (private vars.) */
+    pv_q.head = 0u;
+    pv_q.tail = 0u;
+    pv_q.dropCnt = 0u;
+    TKLq_setRelTsk(&pv_q, NULL, TKLQ_TSK_NONE);
+    TKLsdlr_utModTickSrcTskLst(NULL, NULL, 0u);
+}
+
+/**
+ * \brief Test that messages are passed in place and in order, and that only
+ * committed messages are visible to the consumer
+ */
+void test_TKLq_reserveCommitPeekRelease(void) {
+    pv_msg_t* p_msg = TKLq_reserve(&pv_q);
+
+    TEST_ASSERT_NOT_NULL(p_msg);
+    p_msg->val = 1000u;
+    p_msg->seq = 0u;
+    TEST_ASSERT_NULL(TKLq_peek(&pv_q));
+
+    TKLq_commit(&pv_q);
+    p_msg = TKLq_reserve(&pv_q);
+    p_msg->val = 2000u;
+    p_msg->seq = 1u;
+    TKLq_commit(&pv_q);
+
+    TEST_ASSERT_EQUAL_UINT8(2u, TKLq_cnt(&pv_q));
+
+    const pv_msg_t* p_rcv = TKLq_peek(&pv_q);
+
+    TEST_ASSERT_EQUAL_PTR(&pv_qBuf[0], p_rcv);
+    TEST_ASSERT_EQUAL_UINT16(1000u, p_rcv->val);
+    TKLq_release(&pv_q);
+    p_rcv = TKLq_peek(&pv_q);
+    TEST_ASSERT_EQUAL_UINT8(1u, p_rcv->seq);
+    TKLq_release(&pv_q);
+
+    TEST_ASSERT_NULL(TKLq_peek(&pv_q));
+    TEST_ASSERT_FAIL_ASSERT(TKLq_release(&pv_q));
+}
+
+/**
+ * \brief Test that a full queue drops messages and that slots are reused on
+ * wrap-around
+ */
+void test_TKLq_reserveFullAndWrap(void) {
+    for (uint8_t i = 0u; 4u > i; i++) {
+        TEST_ASSERT_NOT_NULL(TKLq_reserve(&pv_q));
+        TKLq_commit(&pv_q);
+    }
+
+    TEST_ASSERT_NULL(TKLq_reserve(&pv_q));
+    TEST_ASSERT_FAIL_ASSERT(TKLq_commit(&pv_q));
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLq_cntDrop(&pv_q));
+
+    TKLq_release(&pv_q);
+
+    TEST_ASSERT_EQUAL_PTR(&pv_qBuf[0], TKLq_reserve(&pv_q));
+}
+
+/**
+ * \brief Test that committing a message releases the consuming sporadic task
+ */
+void test_TKLq_commitRelTsk(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* .active, .period, .deadline, .lastRun, .p_tskRunner */
+        {true, 10u, 10u, 0u, &TKLtsk_runner0},
+        {true, 0u, 5u, 0u, &TKLtsk_runner1}
+    };
+
+    TKLtick_getTick_ExpectAndReturn(3u);
+
+    TKLtick_getTick_ExpectAndReturn(4u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(4u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 2u);
+    TKLq_setRelTsk(&pv_q, NULL, 1u);
+    TKLsdlr_exec();
+    (void)TKLq_reserve(&pv_q);
+    TKLq_commit(&pv_q);
+    TKLsdlr_exec();
+}
+
+#endif /* TEST */
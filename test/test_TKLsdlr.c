@@ -17,6 +17,8 @@
 
 #include "mock_TKLtsk.h"
 
+#include "TKLsdlrUtTickRollover.h" /* Shared time tick rollover test bodies */
+
 /* "Invisible" API for unit tests to modify internal state (private vars.) */
 extern void TKLsdlr_utModTickSrcTskLst(const TKLtyp_p_getTick_t p_getTick,
                                        TKLtyp_tsk_t* const p_tskLst,
@@ -229,6 +231,33 @@ void test_TKLsdlr_setAndReturnTskLst(void) {
     TEST_ASSERT_EQUAL_PTR(tskLstExp, p_tskLstAct);
 }
 
+/**
+ * \brief Test if a task list defined via migration macros is a plain array of
+ * tasks and accessible via the member access macros
+ */
+void test_TKLsdlr_defTskLstViaMacro(void) {
+#define TSK_LST(X_) \
+    X_(false, 2u, 1u, 0u, &TKLtsk_runner0) \
+    X_(true, 3u, 2u, 1u, &TKLtsk_runner1)
+    TKLSDLR_TSK_LST_DEF(, tskLst, TSK_LST);
+#undef TSK_LST
+
+    TKLsdlr_setTskLst(TKLSDLR_TSK_LST(tskLst), TKLSDLR_TSK_LST_CNT(tskLst));
+
+    TEST_ASSERT_EQUAL_PTR(tskLst, TKLsdlr_getTskLst());
+    TEST_ASSERT_EQUAL_UINT8(2u, TKLsdlr_cntTsk());
+    TEST_ASSERT_TRUE(tskLst[1].active);
+    TEST_ASSERT_EQUAL_UINT32(3u, tskLst[1].period);
+    TEST_ASSERT_EQUAL_UINT32(2u, tskLst[1].deadline);
+    TEST_ASSERT_EQUAL_UINT32(1u, tskLst[1].lastRun);
+    TEST_ASSERT_EQUAL_PTR(&TKLtsk_runner1, tskLst[1].p_tskRunner);
+    TEST_ASSERT_FALSE(TKLSDLR_TSK_ACTIVE(tskLst, 0u));
+    TEST_ASSERT_EQUAL_UINT32(2u, TKLSDLR_TSK_PERIOD(tskLst, 0u));
+    TEST_ASSERT_EQUAL_UINT32(1u, TKLSDLR_TSK_DEADLINE(tskLst, 0u));
+    TEST_ASSERT_EQUAL_UINT32(0u, TKLSDLR_TSK_LAST_RUN(tskLst, 0u));
+    TEST_ASSERT_EQUAL_PTR(&TKLtsk_runner0, TKLSDLR_TSK_RUNNER(tskLst, 0u));
+}
+
 /**
  * \brief Test if task count (number of task entries in the connected task
  * list) is set and returned correctly
@@ -346,72 +375,14 @@ void test_TKLsdlr_detectAndCntMultiTskOverrun(void) {
     TEST_ASSERT_EQUAL_UINT8(overrunExp, TKLsdlr_cntTskOverrun());
 }
 
-/**
- * \brief Test if multiple task deadline overruns are detected and counts
- * returned correctly on relative system time tick count rollover
- */
+/** \brief See \ref pv_detectAndCntMultiTskOverrunOnTickRollover() */
 void test_TKLsdlr_detectAndCntMultiTskOverrunOnTickRollover(void) {
-    TKLtyp_tsk_t tskLst[] = {
-        {.active = true,
-         .period = 100u,
-         .deadline = 100u,
-         .lastRun = 0u,
-         .p_tskRunner = &TKLtsk_runner}
-    };
-    const uint8_t overrunExp = 2u;
-
-    /* Task overrun (at rollover) */
-    TKLtick_getTick_ExpectAndReturn(UINT32_MAX - 10u); /* `4294967285` */
-    TKLtsk_runner_Expect();
-    TKLtick_getTick_ExpectAndReturn(100u);
-
-    /* No task overrun */
-    TKLtick_getTick_ExpectAndReturn(20u);
-    TKLtsk_runner_Expect();
-    TKLtick_getTick_ExpectAndReturn(30u);
-
-    /* Task overrun */
-    TKLtick_getTick_ExpectAndReturn(130);
-    TKLtsk_runner_Expect();
-    TKLtick_getTick_ExpectAndReturn(231u);
-
-    TKLsdlr_setTickSrc(&TKLtick_getTick);
-    TKLsdlr_setTskLst(tskLst, 1u);
-    for (uint8_t i = 0u; i < 3; i++) {
-        TKLsdlr_exec();
-    }
-
-    TEST_ASSERT_EQUAL_UINT8(overrunExp, TKLsdlr_cntTskOverrun());
+    pv_detectAndCntMultiTskOverrunOnTickRollover();
 }
 
-/**
- * \brief Test if single task deadline overrun is detected and count returned
- * on inconvenient relative system time tick count rollover
- *
- * Special "task deadline overrun at time tick rollover" use case scenario.
- * This is an important edge case as it made a previously implemented detailed
- * design solution fail.
- */
+/** \brief See \ref pv_detectAndCntSingleTskOverrunOnInconvTickRollover() */
 void test_TKLsdlr_detectAndCntSingleTskOverrunOnInconvTickRollover(void) {
-    TKLtyp_tsk_t tskLst[] = {
-        {.active = true,
-         .period = 100u,
-         .deadline = 100u,
-         .lastRun = UINT32_MAX - 200u, /* Last run (offset) `4294967095` */
-         .p_tskRunner = &TKLtsk_runner}
-    };
-    const uint8_t overrunExp = 1u;
-
-    /* Task overrun (at rollover) */
-    TKLtick_getTick_ExpectAndReturn(UINT32_MAX - 10u); /* `4294967285` */
-    TKLtsk_runner_Expect();
-    TKLtick_getTick_ExpectAndReturn(10u);
-
-    TKLsdlr_setTickSrc(&TKLtick_getTick);
-    TKLsdlr_setTskLst(tskLst, 1u);
-    TKLsdlr_exec();
-
-    TEST_ASSERT_EQUAL_UINT8(overrunExp, TKLsdlr_cntTskOverrun());
+    pv_detectAndCntSingleTskOverrunOnInconvTickRollover();
 }
 
 /**
@@ -563,6 +534,119 @@ void test_TKLsdlr_updateSingleTskLastRun(void) {
     TEST_ASSERT_EQUAL_UINT32(lastRunExp, tskLst[0].lastRun);
 }
 
+/**
+ * \brief Test that assert fires on attempt to resolve or (de)activate a task
+ * that is not within task list
+ */
+void test_TKLsdlr_assertTskWithinTskLstOnSetTskActIdxMask(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = false,
+         .period = 1u,
+         .deadline = 1u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0},
+        {.active = false,
+         .period = 1u,
+         .deadline = 1u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner1}
+    };
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 2u);
+
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_getTskIdx(NULL));
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_getTskIdx(&TKLtsk_runner2));
+    TEST_ASSERT_PASS_ASSERT(TKLsdlr_setTskActIdx(1u, false, false));
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_setTskActIdx(2u, false, false));
+    TEST_ASSERT_PASS_ASSERT(TKLsdlr_setTskActMask(0x3u, false, false));
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_setTskActMask(0x4u, false, false));
+}
+
+/**
+ * \brief Test if task index is resolved to first task with matching task
+ * runner
+ */
+void test_TKLsdlr_getTskIdxOfFirstMatch(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* .active, .period, .deadline, .lastRun, .p_tskRunner */
+        {true, 1u, 1u, 0u, &TKLtsk_runner0},
+        {true, 1u, 1u, 0u, &TKLtsk_runner1},
+        {true, 1u, 1u, 0u, &TKLtsk_runner1}
+    };
+
+    TKLsdlr_setTskLst(tskLst, 3u);
+
+    TEST_ASSERT_EQUAL_UINT8(0u, TKLsdlr_getTskIdx(&TKLtsk_runner0));
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLsdlr_getTskIdx(&TKLtsk_runner1));
+}
+
+/**
+ * \brief Test if only the task with given index is enabled/disabled, and its
+ * time stamp of last task run is updated correctly
+ */
+void test_TKLsdlr_enaAndDisTskByIdx(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* .active, .period, .deadline, .lastRun, .p_tskRunner */
+        {false, 1u, 1u, 0u, &TKLtsk_runner},
+        {false, 1u, 1u, 0u, &TKLtsk_runner}
+    };
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 2u);
+
+    TKLtick_getTick_ExpectAndReturn(111u);
+    TKLsdlr_setTskActIdx(1u, true, true);
+
+    TEST_ASSERT_FALSE(tskLst[0].active);
+    TEST_ASSERT_EQUAL_UINT32(0u, tskLst[0].lastRun);
+    TEST_ASSERT_TRUE(tskLst[1].active);
+    TEST_ASSERT_EQUAL_UINT32(111u, tskLst[1].lastRun);
+
+    TKLsdlr_setTskActIdx(1u, false, false);
+
+    TEST_ASSERT_FALSE(tskLst[1].active);
+    TEST_ASSERT_EQUAL_UINT32(111u, tskLst[1].lastRun);
+}
+
+/**
+ * \brief Test if a group of tasks is enabled/disabled correctly, with a
+ * single time tick query for all of them
+ */
+void test_TKLsdlr_enaAndDisTskGrpWithSingleTickQuery(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* .active, .period, .deadline, .lastRun, .p_tskRunner */
+        {false, 1u, 1u, 0u, &TKLtsk_runner0},
+        {false, 1u, 1u, 0u, &TKLtsk_runner1}, /* Leave untouched */
+        {false, 1u, 1u, 0u, &TKLtsk_runner2},
+        {true, 1u, 1u, 0u, &TKLtsk_runner0}
+    };
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 4u);
+
+    TKLtick_getTick_ExpectAndReturn(222u);
+    TKLsdlr_setTskActMask(0xDu, true, true); /* Tasks `0`, `2` and `3` */
+
+    TEST_ASSERT_TRUE(tskLst[0].active);
+    TEST_ASSERT_FALSE(tskLst[1].active);
+    TEST_ASSERT_TRUE(tskLst[2].active);
+    TEST_ASSERT_TRUE(tskLst[3].active);
+    TEST_ASSERT_EQUAL_UINT32(222u, tskLst[0].lastRun);
+    TEST_ASSERT_EQUAL_UINT32(0u, tskLst[1].lastRun);
+    TEST_ASSERT_EQUAL_UINT32(222u, tskLst[2].lastRun);
+    TEST_ASSERT_EQUAL_UINT32(222u, tskLst[3].lastRun);
+
+    /* Same for all tasks with the same task runner */
+    TKLtick_getTick_ExpectAndReturn(333u);
+    TKLsdlr_setTskAct(&TKLtsk_runner0, false, true);
+
+    TEST_ASSERT_FALSE(tskLst[0].active);
+    TEST_ASSERT_FALSE(tskLst[3].active);
+    TEST_ASSERT_EQUAL_UINT32(333u, tskLst[0].lastRun);
+    TEST_ASSERT_EQUAL_UINT32(333u, tskLst[3].lastRun);
+}
+
 /**
  * \brief Test correct execution of due-to-run task with 1 time tick period and
  * start at 0 time ticks
@@ -904,59 +988,9 @@ void test_TKLsdlr_checkLastRunIsAlwaysSetToBeginOfPeriod(void) {
     TEST_ASSERT_EQUAL_UINT32(lastRunExp, tskLst[0].lastRun);
 }
 
-/**
- * \brief Test correct execution of due-to-run task at 3 time ticks period with
- * relative system time tick count rollover
- */
+/** \brief See \ref pv_execDueToRunTskAt3TickPeriodOnTickRollover() */
 void test_TKLsdlr_execDueToRunTskAt3TickPeriodOnTickRollover(void) {
-    TKLtyp_tsk_t tskLst[] = {
-        {.active = true,
-         .period = 3u,
-         .deadline = 3u,
-         .lastRun = 0u,
-         .p_tskRunner = &TKLtsk_runner}
-    };
-
-    /* Run */
-    TKLtick_getTick_ExpectAndReturn(UINT32_MAX - 3u); /* `4294967292` */
-    TKLtsk_runner_Expect();
-    TKLtick_getTick_ExpectAndReturn(UINT32_MAX - 3u);
-
-    /* No run */
-    TKLtick_getTick_ExpectAndReturn(UINT32_MAX - 2u); /* `4294967293` */
-    TKLtick_getTick_ExpectAndReturn(UINT32_MAX - 1u); /* `4294967294` */
-
-    /* Run */
-    TKLtick_getTick_ExpectAndReturn(UINT32_MAX); /* `4294967295` */
-    TKLtsk_runner_Expect();
-    TKLtick_getTick_ExpectAndReturn(UINT32_MAX);
-
-    /* No run */
-    TKLtick_getTick_ExpectAndReturn(UINT32_MAX + 1u); /* `0` */
-    TKLtick_getTick_ExpectAndReturn(UINT32_MAX + 2u); /* `1` */
-
-    /* Run */
-    TKLtick_getTick_ExpectAndReturn(UINT32_MAX + 3u); /* `2` */
-    TKLtsk_runner_Expect();
-    TKLtick_getTick_ExpectAndReturn(UINT32_MAX + 3u);
-
-    /* No run */
-    TKLtick_getTick_ExpectAndReturn(UINT32_MAX + 4u); /* `3` */
-    TKLtick_getTick_ExpectAndReturn(UINT32_MAX + 5u); /* `4` */
-
-    /* Run */
-    TKLtick_getTick_ExpectAndReturn(UINT32_MAX + 6u); /* `5` */
-    TKLtsk_runner_Expect();
-    TKLtick_getTick_ExpectAndReturn(UINT32_MAX + 6u);
-
-    /* No run */
-    TKLtick_getTick_ExpectAndReturn(UINT32_MAX + 7u); /* `6` */
-
-    TKLsdlr_setTickSrc(&TKLtick_getTick);
-    TKLsdlr_setTskLst(tskLst, 1u);
-    for (uint8_t i = 0u; i < 11; i++) {
-        TKLsdlr_exec();
-    }
+    pv_execDueToRunTskAt3TickPeriodOnTickRollover();
 }
 
 #endif /* TEST */
@@ -0,0 +1,155 @@
+/** \file */
+
+#ifdef TEST
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "assert.h" /* Sanity checks (Design by Contract); replaced for unit
+                       testing */
+
+#include "unity.h"
+
+#include "TKLsdlr.h"
+
+#include "TKLtyp.h"
+#include "mock_TKLtick.h"
+
+#include "mock_TKLtsk.h"
+
+/* "Invisible" API for unit tests to modify internal state (private vars.) */
+extern void TKLsdlr_utModTickSrcTskLst(const TKLtyp_p_getTick_t p_getTick,
+                                       TKLtyp_tsk_t* const p_tskLst,
+                                       const uint8_t tskCnt);
+
+/* OPERATIONS
+ * ==========
+ */
+
+/** \brief Run before every test */
+void setUp(void) {
+    /* Do nothing */
+}
+
+/** \brief Run after every test */
+void tearDown(void) {
+    /* Reset internal state (private vars.) */
+    TKLsdlr_utModTickSrcTskLst(NULL, NULL, 0u);
+    TKLsdlr_clrTskOverrun();
+}
+
+/**
+ * \brief Test that `lastRun` time of a disabled task is not touched by
+ * execution cycles, but caught up on re-activation as if it was
+ */
+void test_TKLsdlrActMap_setTskActCatchUpLastRunOfDisTsk(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0},
+        {.active = false,
+         .period = 7u,
+         .deadline = 7u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner1}
+    };
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 2u);
+
+    TKLtick_getTick_ExpectAndReturn(10u); /* Cycle ends before disabled task */
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLsdlr_exec();
+
+    TKLtick_getTick_ExpectAndReturn(15u); /* Would update disabled task */
+    TKLsdlr_exec();
+    TEST_ASSERT_EQUAL_UINT32(0u, tskLst[1].lastRun);
+
+    TKLtick_getTick_ExpectAndReturn(20u); /* Cycle ends before disabled task */
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(20u);
+    TKLsdlr_exec();
+    TEST_ASSERT_EQUAL_UINT32(0u, tskLst[1].lastRun);
+
+    TKLtick_getTick_ExpectAndReturn(22u);
+    TKLsdlr_setTskAct(&TKLtsk_runner1, true, false);
+    TEST_ASSERT_EQUAL_UINT32(14u, tskLst[1].lastRun); /* As of cycle at `15` */
+
+    TKLtick_getTick_ExpectAndReturn(22u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(22u);
+    TKLsdlr_exec();
+    TEST_ASSERT_EQUAL_UINT32(21u, tskLst[1].lastRun);
+}
+
+/**
+ * \brief Test that catching up on `lastRun` time updates only considers
+ * execution cycles after `lastRun` time was set on deactivation
+ */
+void test_TKLsdlrActMap_setTskActCatchUpFromUpdLastRun(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner}
+    };
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 1u);
+
+    TKLtick_getTick_ExpectAndReturn(5u);
+    TKLsdlr_exec();
+
+    TKLtick_getTick_ExpectAndReturn(6u);
+    TKLsdlr_setTskAct(&TKLtsk_runner, false, true);
+
+    TKLtick_getTick_ExpectAndReturn(30u);
+    TKLsdlr_exec();
+
+    TKLtick_getTick_ExpectAndReturn(33u);
+    TKLsdlr_setTskAct(&TKLtsk_runner, true, false);
+    TEST_ASSERT_EQUAL_UINT32(26u, tskLst[0].lastRun);
+
+    TKLtick_getTick_ExpectAndReturn(40u);
+    TKLsdlr_setTskAct(&TKLtsk_runner, false, true);
+
+    TKLtick_getTick_ExpectAndReturn(41u); /* No execution cycle since */
+    TKLsdlr_setTskAct(&TKLtsk_runner, true, false);
+    TEST_ASSERT_EQUAL_UINT32(40u, tskLst[0].lastRun);
+}
+
+/**
+ * \brief Test that `lastRun` time of a task that is disabled for longer than
+ * the time tick count range is still caught up on correctly
+ */
+void test_TKLsdlrActMap_setTskActCatchUpOverTickRange(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = false,
+         .period = 1000u,
+         .deadline = 1000u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner}
+    };
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 1u);
+
+    TKLtick_getTick_ExpectAndReturn(0x7FFFFF00u);
+    TKLsdlr_exec();
+    TKLtick_getTick_ExpectAndReturn(0x80000100u);
+    TKLsdlr_exec();
+    TKLtick_getTick_ExpectAndReturn(0xFFFFFF00u);
+    TKLsdlr_exec();
+    TKLtick_getTick_ExpectAndReturn(0x00000100u); /* Rollover */
+    TKLsdlr_exec();
+
+    TKLtick_getTick_ExpectAndReturn(0x00000180u);
+    TKLsdlr_setTskAct(&TKLtsk_runner, true, false);
+    TEST_ASSERT_EQUAL_UINT32(4294967000u, tskLst[0].lastRun);
+}
+
+#endif /* TEST */
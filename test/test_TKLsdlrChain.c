@@ -0,0 +1,140 @@
+/** \file */
+
+#ifdef TEST
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "assert.h" /* Sanity checks (Design by Contract); replaced for unit
+                       testing */
+
+#include "unity.h"
+
+#include "TKLsdlr.h"
+
+#include "TKLtyp.h"
+#include "mock_TKLtick.h"
+
+#include "mock_TKLtsk.h"
+
+/* "Invisible" API for unit tests to modify internal state (private vars.) */
+extern void TKLsdlr_utModTickSrcTskLst(const TKLtyp_p_getTick_t p_getTick,
+                                       TKLtyp_tsk_t* const p_tskLst,
+                                       const uint8_t tskCnt);
+
+/* OPERATIONS
+ * ==========
+ */
+
+/** \brief Run before every test */
+void setUp(void) {
+    /* Do nothing */
+}
+
+/** \brief Run after every test */
+void tearDown(void) {
+    /* Reset internal state (private vars.) */
+    TKLsdlr_utModTickSrcTskLst(NULL, NULL, 0u);
+}
+
+/**
+ * \brief Test that only acyclic chains with sporadic consumers can be
+ * registered
+ */
+void test_TKLsdlrChain_setChainTbl(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* .active, .period, .deadline, .lastRun, .p_tskRunner */
+        {true, 10u, 10u, 0u, &TKLtsk_runner0},
+        {true, 0u, 10u, 0u, &TKLtsk_runner1},
+        {true, 0u, 10u, 0u, &TKLtsk_runner2}
+    };
+    const TKLtyp_chain_t chain[] = {
+        /* .headTsk, .deadline */
+        {0u, 10u}
+    };
+    const uint32_t consCyclic[] = {0x2u, 0x4u, 0x2u};
+    const uint32_t consPeriodic[] = {0x0u, 0x1u, 0x0u};
+    const TKLtyp_chainTbl_t chainTblCyclic = {1u, chain, 3u, consCyclic};
+    const TKLtyp_chainTbl_t chainTblPeriodic = {1u, chain, 3u, consPeriodic};
+
+    TKLsdlr_setTskLst(tskLst, 3u);
+
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_setChainTbl(&chainTblCyclic));
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_setChainTbl(&chainTblPeriodic));
+}
+
+/**
+ * \brief Test that consumers are run back-to-back right after their producer,
+ * within the same scheduler call
+ */
+void test_TKLsdlrChain_execBackToBack(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* .active, .period, .deadline, .lastRun, .p_tskRunner */
+        {true, 10u, 10u, 0u, &TKLtsk_runner0},
+        {true, 0u, 10u, 0u, &TKLtsk_runner1},
+        {true, 0u, 10u, 0u, &TKLtsk_runner2}
+    };
+    const TKLtyp_chain_t chain[] = {
+        /* .headTsk, .deadline */
+        {0u, 5u}
+    };
+    const uint32_t cons[] = {0x2u, 0x4u, 0x0u};
+    const TKLtyp_chainTbl_t chainTbl = {1u, chain, 3u, cons};
+
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(11u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(12u);
+    TKLtsk_runner2_Expect();
+    TKLtick_getTick_ExpectAndReturn(13u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 3u);
+    TKLsdlr_setChainTbl(&chainTbl);
+    TKLsdlr_exec();
+
+    TEST_ASSERT_EQUAL_UINT32(12u, tskLst[2].lastRun);
+    TEST_ASSERT_EQUAL_UINT32(3u, TKLsdlr_getChainLat(0u));
+    TEST_ASSERT_EQUAL_UINT8(0u, TKLsdlr_cntChainOverrun());
+}
+
+/**
+ * \brief Test that a consumer with several producers waits for all of them,
+ * and that end-to-end deadline overruns are counted
+ */
+void test_TKLsdlrChain_execJoinAndOverrun(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* .active, .period, .deadline, .lastRun, .p_tskRunner */
+        {true, 10u, 10u, 0u, &TKLtsk_runner0},
+        {true, 0u, 10u, 0u, &TKLtsk_runner1},
+        {true, 0u, 10u, 0u, &TKLtsk_runner2},
+        {true, 0u, 10u, 0u, &TKLtsk_runner}
+    };
+    const TKLtyp_chain_t chain[] = {
+        /* .headTsk, .deadline */
+        {0u, 3u}
+    };
+    const uint32_t cons[] = {0xCu, 0x0u, 0x2u, 0x2u};
+    const TKLtyp_chainTbl_t chainTbl = {1u, chain, 4u, cons};
+
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(11u);
+    TKLtsk_runner2_Expect();
+    TKLtick_getTick_ExpectAndReturn(12u);
+    TKLtsk_runner_Expect();
+    TKLtick_getTick_ExpectAndReturn(13u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(14u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 4u);
+    TKLsdlr_setChainTbl(&chainTbl);
+    TKLsdlr_exec();
+
+    TEST_ASSERT_EQUAL_UINT32(4u, TKLsdlr_getChainLat(0u));
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLsdlr_cntChainOverrun());
+}
+
+#endif /* TEST */
@@ -0,0 +1,177 @@
+/** \file */
+
+#ifdef TEST
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "assert.h" /* Sanity checks (Design by Contract); replaced for unit
+                       testing */
+
+#include "unity.h"
+
+#include "TKLsdlr.h"
+
+#include "TKLtyp.h"
+#include "mock_TKLtick.h"
+
+#include "mock_TKLtsk.h"
+
+/* "Invisible" API for unit tests to modify internal state (private vars.) */
+extern void TKLsdlr_utModTickSrcTskLst(const TKLtyp_p_getTick_t p_getTick,
+                                       TKLtyp_tsk_t* const p_tskLst,
+                                       const uint8_t tskCnt);
+
+/* ATTRIBUTES
+ * ==========
+ */
+
+/** \brief Scheduler instances under test */
+static TKLsdlr_ctx_t pv_ctxA, pv_ctxB;
+
+/* OPERATIONS
+ * ==========
+ */
+
+/** \brief Run before every test */
+void setUp(void) {
+    TKLsdlr_ctxInit(&pv_ctxA);
+    TKLsdlr_ctxInit(&pv_ctxB);
+}
+
+/** \brief Run after every test */
+void tearDown(void) {
+    /* Reset internal state (private vars.) */
+    TKLsdlr_utModTickSrcTskLst(NULL, NULL, 0u);
+    TKLsdlr_clrTskOverrun();
+}
+
+/** \brief Test that assert fires on attempt to initialize no instance */
+void test_TKLsdlrCtx_assertInvalidArgOnInit(void) {
+    TEST_ASSERT_PASS_ASSERT(TKLsdlr_ctxInit(&pv_ctxA));
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_ctxInit(NULL));
+}
+
+/**
+ * \brief Test that task lists registered with different instances (and the
+ * default instance) do not interfere
+ */
+void test_TKLsdlrCtx_setTskLstPerCtx(void) {
+    TKLtyp_tsk_t tskLstA[] = {
+        {.active = true,
+         .period = 1u,
+         .deadline = 1u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0}
+    };
+    TKLtyp_tsk_t tskLstB[] = {
+        {.active = true,
+         .period = 1u,
+         .deadline = 1u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner1},
+        {.active = true,
+         .period = 1u,
+         .deadline = 1u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner2}
+    };
+
+    TKLsdlr_ctxSetTskLst(&pv_ctxA, tskLstA, 1u);
+    TKLsdlr_ctxSetTskLst(&pv_ctxB, tskLstB, 2u);
+
+    TEST_ASSERT_EQUAL_PTR(tskLstA, TKLsdlr_ctxGetTskLst(&pv_ctxA));
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLsdlr_ctxCntTsk(&pv_ctxA));
+    TEST_ASSERT_EQUAL_PTR(tskLstB, TKLsdlr_ctxGetTskLst(&pv_ctxB));
+    TEST_ASSERT_EQUAL_UINT8(2u, TKLsdlr_ctxCntTsk(&pv_ctxB));
+    TEST_ASSERT_NULL(TKLsdlr_getTskLst()); /* Default instance untouched */
+    TEST_ASSERT_EQUAL_UINT8(0u, TKLsdlr_cntTsk());
+}
+
+/**
+ * \brief Test that instances run their own task lists with their own time
+ * tick sources and keep their own deadline overrun counters
+ */
+void test_TKLsdlrCtx_execPerCtx(void) {
+    TKLtyp_tsk_t tskLstA[] = {
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0}
+    };
+    TKLtyp_tsk_t tskLstB[] = {
+        {.active = true,
+         .period = 1u,
+         .deadline = 1u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner1}
+    };
+
+    TKLsdlr_ctxSetTickSrc(&pv_ctxA, &TKLtick_getTick);
+    TKLsdlr_ctxSetTskLst(&pv_ctxA, tskLstA, 1u);
+    TKLsdlr_ctxSetTickSrc(&pv_ctxB, &TKLtick_getTick);
+    TKLsdlr_ctxSetTskLst(&pv_ctxB, tskLstB, 1u);
+
+    /* Task of instance A not yet due, task of instance B overruns */
+    TKLtick_getTick_ExpectAndReturn(5u);
+    TKLsdlr_ctxExec(&pv_ctxA);
+    TKLtick_getTick_ExpectAndReturn(5u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(7u);
+    TKLsdlr_ctxExec(&pv_ctxB);
+
+    TEST_ASSERT_EQUAL_UINT32(0u, tskLstA[0].lastRun);
+    TEST_ASSERT_EQUAL_UINT32(5u, tskLstB[0].lastRun);
+    TEST_ASSERT_EQUAL_UINT8(0u, TKLsdlr_ctxCntTskOverrun(&pv_ctxA));
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLsdlr_ctxCntTskOverrun(&pv_ctxB));
+    TEST_ASSERT_EQUAL_UINT8(0u, TKLsdlr_cntTskOverrun());
+
+    /* Task of instance A due */
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLsdlr_ctxExec(&pv_ctxA);
+
+    TEST_ASSERT_EQUAL_UINT32(10u, tskLstA[0].lastRun);
+    TEST_ASSERT_EQUAL_UINT32(5u, tskLstB[0].lastRun);
+
+    TKLsdlr_ctxClrTskOverrun(&pv_ctxB);
+    TEST_ASSERT_EQUAL_UINT8(0u, TKLsdlr_ctxCntTskOverrun(&pv_ctxB));
+}
+
+/**
+ * \brief Test that (de)activating a task only affects the task list of the
+ * given instance
+ */
+void test_TKLsdlrCtx_setTskActPerCtx(void) {
+    TKLtyp_tsk_t tskLstA[] = {
+        {.active = true,
+         .period = 1u,
+         .deadline = 1u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner}
+    };
+    TKLtyp_tsk_t tskLstB[] = {
+        {.active = true,
+         .period = 1u,
+         .deadline = 1u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner}
+    };
+
+    TKLsdlr_ctxSetTickSrc(&pv_ctxA, &TKLtick_getTick);
+    TKLsdlr_ctxSetTskLst(&pv_ctxA, tskLstA, 1u);
+    TKLsdlr_ctxSetTickSrc(&pv_ctxB, &TKLtick_getTick);
+    TKLsdlr_ctxSetTskLst(&pv_ctxB, tskLstB, 1u);
+
+    TKLtick_getTick_ExpectAndReturn(3u);
+    TKLsdlr_ctxSetTskAct(&pv_ctxB, &TKLtsk_runner, false, true);
+
+    TEST_ASSERT_TRUE(tskLstA[0].active);
+    TEST_ASSERT_EQUAL_UINT32(0u, tskLstA[0].lastRun);
+    TEST_ASSERT_FALSE(tskLstB[0].active);
+    TEST_ASSERT_EQUAL_UINT32(3u, tskLstB[0].lastRun);
+}
+
+#endif /* TEST */
@@ -0,0 +1,158 @@
+/** \file */
+
+#ifdef TEST
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "assert.h" /* Sanity checks (Design by Contract); replaced for unit
+                       testing */
+
+#include "unity.h"
+
+#include "TKLsdlr.h"
+
+#include "TKLtyp.h"
+#include "mock_TKLtick.h"
+
+#include "mock_TKLtsk.h"
+
+/* "Invisible" API for unit tests to modify internal state (private vars.) */
+extern void TKLsdlr_utModTickSrcTskLst(const TKLtyp_p_getTick_t p_getTick,
+                                       TKLtyp_tsk_t* const p_tskLst,
+                                       const uint8_t tskCnt);
+
+/* OPERATIONS
+ * ==========
+ */
+
+/** \brief Run before every test */
+void setUp(void) {
+    /* Do nothing */
+}
+
+/** \brief Run after every test */
+void tearDown(void) {
+    /* Reset internal state (private vars.) */
+    TKLsdlr_utModTickSrcTskLst(NULL, NULL, 0u);
+    TKLsdlr_clrTskOverrun();
+}
+
+/**
+ * \brief Test that dispatch order is sorted by deadline (stable), that its
+ * difference from task list order is reported, and that the task list itself
+ * is left untouched
+ */
+void test_TKLsdlrDm_setTskLstBuildDispOrder(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* .active, .period, .deadline, .lastRun, .p_tskRunner */
+        {true, 10u, 10u, 0u, &TKLtsk_runner0},
+        {true, 10u, 5u, 0u, &TKLtsk_runner1},
+        {true, 10u, 5u, 0u, &TKLtsk_runner2},
+        {true, 20u, 20u, 0u, &TKLtsk_runner},
+        {true, 10u, 1u, 0u, &TKLtsk_runner}
+    };
+
+    TKLsdlr_setTskLst(tskLst, 5u);
+
+    TEST_ASSERT_EQUAL_UINT8(4u, TKLsdlr_getDispTsk(0u));
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLsdlr_getDispTsk(1u));
+    TEST_ASSERT_EQUAL_UINT8(2u, TKLsdlr_getDispTsk(2u));
+    TEST_ASSERT_EQUAL_UINT8(0u, TKLsdlr_getDispTsk(3u));
+    TEST_ASSERT_EQUAL_UINT8(3u, TKLsdlr_getDispTsk(4u));
+    TEST_ASSERT_EQUAL_UINT8(3u, TKLsdlr_cntTskMisorder());
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_getDispTsk(5u));
+
+    TEST_ASSERT_EQUAL_PTR(&TKLtsk_runner0, tskLst[0].p_tskRunner);
+    TEST_ASSERT_EQUAL_UINT32(1u, tskLst[4].deadline);
+}
+
+/**
+ * \brief Test that a task list already in deadline-monotonic order (with equal
+ * deadlines) is reported as such
+ */
+void test_TKLsdlrDm_setTskLstInOrder(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* .active, .period, .deadline, .lastRun, .p_tskRunner */
+        {true, 10u, 2u, 0u, &TKLtsk_runner0},
+        {true, 10u, 2u, 0u, &TKLtsk_runner1},
+        {true, 10u, 3u, 0u, &TKLtsk_runner2}
+    };
+
+    TKLsdlr_setTskLst(tskLst, 3u);
+
+    TEST_ASSERT_EQUAL_UINT8(0u, TKLsdlr_cntTskMisorder());
+    TEST_ASSERT_EQUAL_UINT8(0u, TKLsdlr_getDispTsk(0u));
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLsdlr_getDispTsk(1u));
+}
+
+/**
+ * \brief Test that due-to-run tasks are run in dispatch order instead of task
+ * list order
+ */
+void test_TKLsdlrDm_execRunInDispOrder(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0},
+        {.active = true,
+         .period = 10u,
+         .deadline = 3u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner1}
+    };
+
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(11u);
+
+    TKLtick_getTick_ExpectAndReturn(11u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(12u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 2u);
+    TKLsdlr_exec();
+    TKLsdlr_exec();
+
+    TEST_ASSERT_EQUAL_UINT8(0u, TKLsdlr_cntTskOverrun());
+}
+
+/**
+ * \brief Test that pending events are handled in dispatch order instead of
+ * task list order
+ */
+void test_TKLsdlrDm_execHandleEvtInDispOrder(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 0u,
+         .deadline = 8u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0},
+        {.active = true,
+         .period = 0u,
+         .deadline = 2u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner1}
+    };
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 2u);
+
+    TKLsdlr_postEvt(0u);
+    TKLsdlr_postEvt(1u);
+
+    TKLtick_getTick_ExpectAndReturn(1u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(1u);
+    TKLsdlr_exec();
+
+    TKLtick_getTick_ExpectAndReturn(2u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(2u);
+    TKLsdlr_exec();
+}
+
+#endif /* TEST */
@@ -0,0 +1,192 @@
+/** \file */
+
+#ifdef TEST
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "assert.h" /* Sanity checks (Design by Contract); replaced for unit
+                       testing */
+
+#include "unity.h"
+
+#include "TKLsdlr.h"
+
+#include "TKLtyp.h"
+#include "mock_TKLtick.h"
+
+#include "mock_TKLtsk.h"
+
+/* "Invisible" API for unit tests to modify internal state (private vars.) */
+extern void TKLsdlr_utModTickSrcTskLst(const TKLtyp_p_getTick_t p_getTick,
+                                       TKLtyp_tsk_t* const p_tskLst,
+                                       const uint8_t tskCnt);
+
+/* OPERATIONS
+ * ==========
+ */
+
+/** \brief Run before every test */
+void setUp(void) {
+    /* Do nothing */
+}
+
+/** \brief Run after every test */
+void tearDown(void) {
+    /* Reset internal state (private vars.) */
+    TKLsdlr_utModTickSrcTskLst(NULL, NULL, 0u);
+    TKLsdlr_clrTskOverrun();
+}
+
+/**
+ * \brief Test that due-to-run tasks are run in order of their absolute
+ * deadlines instead of task list order
+ */
+void test_TKLsdlrEdf_execRunEarliestDeadlineFirst(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* Deadline at `20` */
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0},
+        /* Deadline at `15` */
+        {.active = true,
+         .period = 5u,
+         .deadline = 5u,
+         .lastRun = 5u,
+         .p_tskRunner = &TKLtsk_runner1},
+        /* Deadline at `12` */
+        {.active = true,
+         .period = 10u,
+         .deadline = 2u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner2}
+    };
+
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLtsk_runner2_Expect();
+    TKLtick_getTick_ExpectAndReturn(11u);
+
+    TKLtick_getTick_ExpectAndReturn(11u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(12u);
+
+    TKLtick_getTick_ExpectAndReturn(12u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(13u);
+
+    TKLtick_getTick_ExpectAndReturn(13u); /* No run */
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 3u);
+    for (uint8_t i = 0u; i < 4; i++) {
+        TKLsdlr_exec();
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(10u, tskLst[0].lastRun);
+    TEST_ASSERT_EQUAL_UINT32(10u, tskLst[1].lastRun);
+    TEST_ASSERT_EQUAL_UINT32(10u, tskLst[2].lastRun);
+    TEST_ASSERT_EQUAL_UINT8(0u, TKLsdlr_cntTskOverrun());
+}
+
+/** \brief Test that ties of absolute deadlines are broken by task list order */
+void test_TKLsdlrEdf_execRunInTskLstOrderOnTie(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 4u,
+         .deadline = 4u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0},
+        {.active = true,
+         .period = 2u,
+         .deadline = 6u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner1}
+    };
+
+    TKLtick_getTick_ExpectAndReturn(4u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(4u);
+
+    TKLtick_getTick_ExpectAndReturn(4u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(4u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 2u);
+    TKLsdlr_exec();
+    TKLsdlr_exec();
+
+    /* Lost period of second task */
+    TEST_ASSERT_EQUAL_UINT32(4u, tskLst[1].lastRun);
+}
+
+/**
+ * \brief Test that absolute deadlines are compared correctly on time tick
+ * count rollover
+ */
+void test_TKLsdlrEdf_execRunEarliestDeadlineFirstOnTickRollover(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* Deadline at `0x00000004` */
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = UINT32_MAX - 15u,
+         .p_tskRunner = &TKLtsk_runner0},
+        /* Deadline at `UINT32_MAX - 1` */
+        {.active = true,
+         .period = 3u,
+         .deadline = 3u,
+         .lastRun = UINT32_MAX - 7u,
+         .p_tskRunner = &TKLtsk_runner1}
+    };
+
+    TKLtick_getTick_ExpectAndReturn(UINT32_MAX - 4u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(UINT32_MAX - 3u);
+
+    TKLtick_getTick_ExpectAndReturn(UINT32_MAX - 3u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(UINT32_MAX - 2u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 2u);
+    TKLsdlr_exec();
+    TKLsdlr_exec();
+
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX - 5u, tskLst[0].lastRun);
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX - 4u, tskLst[1].lastRun);
+}
+
+/**
+ * \brief Test that disabled due-to-run tasks are not run, but still get their
+ * `lastRun` time updated, even with an earlier deadline
+ */
+void test_TKLsdlrEdf_execIgnoreDisabledTsk(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0},
+        {.active = false,
+         .period = 5u,
+         .deadline = 1u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner1}
+    };
+
+    TKLtick_getTick_ExpectAndReturn(12u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(12u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 2u);
+    TKLsdlr_exec();
+
+    TEST_ASSERT_EQUAL_UINT32(10u, tskLst[0].lastRun);
+    TEST_ASSERT_EQUAL_UINT32(10u, tskLst[1].lastRun);
+}
+
+#endif /* TEST */
@@ -0,0 +1,277 @@
+/** \file */
+
+#ifdef TEST
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "assert.h" /* Sanity checks (Design by Contract); replaced for unit
+                       testing */
+
+#include "unity.h"
+
+#include "TKLsdlr.h"
+
+#include "TKLtyp.h"
+#include "mock_TKLtick.h"
+
+#include "mock_TKLtsk.h"
+
+/* "Invisible" API for unit tests to modify internal state (private vars.) */
+extern void TKLsdlr_utModTickSrcTskLst(const TKLtyp_p_getTick_t p_getTick,
+                                       TKLtyp_tsk_t* const p_tskLst,
+                                       const uint8_t tskCnt);
+
+/* OPERATIONS
+ * ==========
+ */
+
+/** \brief Run before every test */
+void setUp(void) {
+    /* Do nothing */
+}
+
+/** \brief Run after every test */
+void tearDown(void) {
+    /* Reset internal state (private vars.) */
+    TKLsdlr_utModTickSrcTskLst(NULL, NULL, 0u);
+    TKLsdlr_clrTskOverrun();
+}
+
+/**
+ * \brief Test that assert fires on attempt to post an event to a task that is
+ * not a sporadic task within registered task list
+ */
+void test_TKLsdlrEvt_assertInvalidArgOnPostEvt(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 0u,
+         .deadline = 1u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0},
+        {.active = true,
+         .period = 1u,
+         .deadline = 1u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner1}
+    };
+
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_postEvt(0u)); /* No task list */
+
+    TKLsdlr_setTskLst(tskLst, 2u);
+
+    TEST_ASSERT_PASS_ASSERT(TKLsdlr_postEvt(0u));
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_postEvt(1u)); /* Periodic task */
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_postEvt(2u)); /* Out of task list */
+}
+
+/**
+ * \brief Test that a sporadic task is only run on a posted event, with
+ * `lastRun` set to the start of the handling execution cycle
+ */
+void test_TKLsdlrEvt_execRunSporadicTskOnEvt(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 0u,
+         .deadline = 2u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0}
+    };
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 1u);
+
+    TKLtick_getTick_ExpectAndReturn(100u); /* No event */
+    TKLsdlr_exec();
+
+    TKLsdlr_postEvt(0u);
+
+    TKLtick_getTick_ExpectAndReturn(105u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(106u);
+    TKLsdlr_exec();
+
+    TEST_ASSERT_EQUAL_UINT32(105u, tskLst[0].lastRun);
+    TEST_ASSERT_EQUAL_UINT8(0u, TKLsdlr_cntTskOverrun());
+
+    TKLtick_getTick_ExpectAndReturn(110u); /* Event consumed */
+    TKLsdlr_exec();
+
+    /* Deadline overrun is relative to handling execution cycle */
+    TKLsdlr_postEvt(0u);
+
+    TKLtick_getTick_ExpectAndReturn(120u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(123u);
+    TKLsdlr_exec();
+
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLsdlr_cntTskOverrun());
+}
+
+/**
+ * \brief Test that pending events and due periodic tasks are handled in task
+ * list order (priority), one per execution cycle
+ */
+void test_TKLsdlrEvt_execRunInTskLstOrder(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0},
+        {.active = true,
+         .period = 0u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner1},
+        {.active = true,
+         .period = 0u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner2},
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner}
+    };
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 4u);
+
+    TKLsdlr_postEvt(2u);
+    TKLsdlr_postEvt(1u);
+
+    /* Periodic task with higher priority first */
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLsdlr_exec();
+
+    /* Highest priority event next */
+    TKLtick_getTick_ExpectAndReturn(11u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(11u);
+    TKLsdlr_exec();
+
+    TKLtick_getTick_ExpectAndReturn(12u);
+    TKLtsk_runner2_Expect();
+    TKLtick_getTick_ExpectAndReturn(12u);
+    TKLsdlr_exec();
+
+    /* Periodic task with lower priority last */
+    TKLtick_getTick_ExpectAndReturn(13u);
+    TKLtsk_runner_Expect();
+    TKLtick_getTick_ExpectAndReturn(13u);
+    TKLsdlr_exec();
+
+    TEST_ASSERT_EQUAL_UINT32(10u, tskLst[0].lastRun);
+    TEST_ASSERT_EQUAL_UINT32(11u, tskLst[1].lastRun);
+    TEST_ASSERT_EQUAL_UINT32(12u, tskLst[2].lastRun);
+    TEST_ASSERT_EQUAL_UINT32(10u, tskLst[3].lastRun);
+}
+
+/**
+ * \brief Test that events posted while one is pending are merged, and that
+ * events of disabled tasks are dropped
+ */
+void test_TKLsdlrEvt_execMergeAndDropEvt(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 0u,
+         .deadline = 1u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0},
+        {.active = false,
+         .period = 0u,
+         .deadline = 1u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner1}
+    };
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 2u);
+
+    TKLsdlr_postEvt(0u);
+    TKLsdlr_postEvt(0u);
+    TKLsdlr_postEvt(0u);
+
+    TKLtick_getTick_ExpectAndReturn(1u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(1u);
+    TKLsdlr_exec();
+
+    TKLtick_getTick_ExpectAndReturn(2u); /* Only run once */
+    TKLsdlr_exec();
+
+    TKLsdlr_postEvt(1u);
+
+    TKLtick_getTick_ExpectAndReturn(3u); /* Disabled, event dropped */
+    TKLsdlr_exec();
+    TEST_ASSERT_EQUAL_UINT32(3u, tskLst[1].lastRun);
+
+    tskLst[1].active = true;
+
+    TKLtick_getTick_ExpectAndReturn(4u); /* Not run on enabling */
+    TKLsdlr_exec();
+}
+
+/**
+ * \brief Test that events pending on registration of a task list are
+ * discarded
+ */
+void test_TKLsdlrEvt_setTskLstDiscardEvt(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 0u,
+         .deadline = 1u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0}
+    };
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 1u);
+
+    TKLsdlr_postEvt(0u);
+    TKLsdlr_setTskLst(tskLst, 1u);
+
+    TKLtick_getTick_ExpectAndReturn(1u);
+    TKLsdlr_exec();
+}
+
+/**
+ * \brief Test that there is no time until next task release while an event is
+ * pending, and that sporadic tasks are otherwise ignored
+ */
+void test_TKLsdlrEvt_cntTickToNextRelWithEvt(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 0u,
+         .deadline = 1u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0},
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner1}
+    };
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 1u); /* Sporadic task only */
+
+    TKLtick_getTick_ExpectAndReturn(4u);
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, TKLsdlr_cntTickToNextRel());
+
+    TKLsdlr_setTskLst(tskLst, 2u);
+
+    TKLtick_getTick_ExpectAndReturn(4u);
+    TEST_ASSERT_EQUAL_UINT32(6u, TKLsdlr_cntTickToNextRel());
+
+    TKLsdlr_postEvt(0u);
+
+    TKLtick_getTick_ExpectAndReturn(4u);
+    TEST_ASSERT_EQUAL_UINT32(0u, TKLsdlr_cntTickToNextRel());
+}
+
+#endif /* TEST */
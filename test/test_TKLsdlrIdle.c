@@ -0,0 +1,193 @@
+/** \file */
+
+#ifdef TEST
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "assert.h" /* Sanity checks (Design by Contract); replaced for unit
+                       testing */
+
+#include "unity.h"
+
+#include "TKLsdlr.h"
+
+#include "TKLtyp.h"
+#include "mock_TKLtick.h"
+
+#include "mock_TKLtsk.h"
+
+/* "Invisible" API for unit tests to modify internal state (private vars.) */
+extern void TKLsdlr_utModTickSrcTskLst(const TKLtyp_p_getTick_t p_getTick,
+                                       TKLtyp_tsk_t* const p_tskLst,
+                                       const uint8_t tskCnt);
+
+/* OPERATIONS
+ * ==========
+ */
+
+/** \brief Run before every test */
+void setUp(void) {
+    /* Do nothing */
+}
+
+/** \brief Run after every test */
+void tearDown(void) {
+    /* Reset internal state (private vars.) */
+    TKLsdlr_utModTickSrcTskLst(NULL, NULL, 0u);
+    TKLsdlr_clrTskOverrun();
+}
+
+/**
+ * \brief Test that assert fires on attempt to count time ticks to next task
+ * release with incomplete initialization
+ */
+void test_TKLsdlrIdle_assertIncompleteInitOnCntTickToNextRel(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 1u,
+         .deadline = 1u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner}
+    };
+
+    TKLsdlr_utModTickSrcTskLst(NULL, tskLst, 1u);
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_cntTickToNextRel());
+
+    TKLsdlr_utModTickSrcTskLst(&TKLtick_getTick, NULL, 1u);
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_cntTickToNextRel());
+
+    TKLsdlr_utModTickSrcTskLst(&TKLtick_getTick, tskLst, 0u);
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_cntTickToNextRel());
+}
+
+/**
+ * \brief Test that number of time ticks to next task release is the minimum
+ * over all enabled tasks
+ */
+void test_TKLsdlrIdle_cntTickToNextRelOfEnaTsk(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* Disabled, would be released at `12` */
+        {.active = false,
+         .period = 2u,
+         .deadline = 2u,
+         .lastRun = 10u,
+         .p_tskRunner = &TKLtsk_runner0},
+        /* Released at `17` */
+        {.active = true,
+         .period = 7u,
+         .deadline = 7u,
+         .lastRun = 10u,
+         .p_tskRunner = &TKLtsk_runner1},
+        /* Released at `15` */
+        {.active = true,
+         .period = 5u,
+         .deadline = 5u,
+         .lastRun = 10u,
+         .p_tskRunner = &TKLtsk_runner2}
+    };
+
+    TKLtick_getTick_ExpectAndReturn(11u);
+    TKLtick_getTick_ExpectAndReturn(14u);
+    TKLtick_getTick_ExpectAndReturn(15u);
+    TKLtick_getTick_ExpectAndReturn(99u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 3u);
+    TEST_ASSERT_EQUAL_UINT32(4u, TKLsdlr_cntTickToNextRel());
+    TEST_ASSERT_EQUAL_UINT32(1u, TKLsdlr_cntTickToNextRel());
+    TEST_ASSERT_EQUAL_UINT32(0u, TKLsdlr_cntTickToNextRel());
+    TEST_ASSERT_EQUAL_UINT32(0u, TKLsdlr_cntTickToNextRel());
+}
+
+/**
+ * \brief Test that number of time ticks to next task release is max. value if
+ * no task is enabled
+ */
+void test_TKLsdlrIdle_cntTickToNextRelIsMaxIfNoTskIsEna(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = false,
+         .period = 2u,
+         .deadline = 2u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner}
+    };
+
+    TKLtick_getTick_ExpectAndReturn(1000u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 1u);
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX, TKLsdlr_cntTickToNextRel());
+}
+
+/**
+ * \brief Test that number of time ticks to next task release is still correct
+ * on time tick count rollover
+ */
+void test_TKLsdlrIdle_cntTickToNextRelOnTickRollover(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* Released at `UINT32_MAX + 6` */
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = UINT32_MAX - 3u,
+         .p_tskRunner = &TKLtsk_runner}
+    };
+
+    TKLtick_getTick_ExpectAndReturn(UINT32_MAX - 1u);
+    TKLtick_getTick_ExpectAndReturn(2u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 1u);
+    TEST_ASSERT_EQUAL_UINT32(8u, TKLsdlr_cntTickToNextRel());
+    TEST_ASSERT_EQUAL_UINT32(4u, TKLsdlr_cntTickToNextRel());
+}
+
+/**
+ * \brief Test that idle hook is run (only) in scheduling algorithm execution
+ * cycles without any task being run
+ */
+void test_TKLsdlrIdle_runIdleHookOnlyIfNoTskIsRun(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* Released at `5` */
+        {.active = true,
+         .period = 5u,
+         .deadline = 5u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0},
+        /* Released at `8` */
+        {.active = true,
+         .period = 8u,
+         .deadline = 8u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner1}
+    };
+
+    /* No task is run, sleep until `5` */
+    TKLtick_getTick_ExpectAndReturn(1u);
+    TKLtick_getTick_ExpectAndReturn(1u);
+    TKLtsk_idleHook_Expect(4u);
+
+    /* Run task runner 0, no idle hook */
+    TKLtick_getTick_ExpectAndReturn(5u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(5u);
+
+    /* No task is run, sleep until `8` */
+    TKLtick_getTick_ExpectAndReturn(6u);
+    TKLtick_getTick_ExpectAndReturn(6u);
+    TKLtsk_idleHook_Expect(2u);
+
+    /* Run task runner 1, no idle hook */
+    TKLtick_getTick_ExpectAndReturn(8u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(8u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 2u);
+    for (uint8_t i = 0u; i < 4; i++) {
+        TKLsdlr_exec();
+    }
+}
+
+#endif /* TEST */
@@ -0,0 +1,137 @@
+/** \file */
+
+#ifdef TEST
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "assert.h" /* Sanity checks (Design by Contract); replaced for unit
+                       testing */
+
+#include "unity.h"
+
+#include "TKLsdlr.h"
+
+#include "TKLtyp.h"
+#include "mock_TKLtick.h"
+
+#include "mock_TKLtsk.h"
+
+/* "Invisible" API for unit tests to modify internal state (private vars.) */
+extern void TKLsdlr_utModTickSrcTskLst(const TKLtyp_p_getTick_t p_getTick,
+                                       TKLtyp_tsk_t* const p_tskLst,
+                                       const uint8_t tskCnt);
+
+/* OPERATIONS
+ * ==========
+ */
+
+/** \brief Run before every test */
+void setUp(void) {
+    /* Do nothing */
+}
+
+/** \brief Run after every test */
+void tearDown(void) {
+    /* Reset internal state (private vars.) */
+    TKLsdlr_utModTickSrcTskLst(NULL, NULL, 0u);
+    TKLsdlr_clrTskOverrun();
+}
+
+/**
+ * \brief Test that CPU load measurement is enabled for this test file (with 4
+ * sub-windows of 10 time ticks)
+ */
+void test_TKLsdlrLoad_checkLoadIsEna(void) {
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLSDLRCFG_LOAD_ENA);
+    TEST_ASSERT_EQUAL_UINT32(40u, TKLSDLRCFG_LOAD_WIN);
+    TEST_ASSERT_EQUAL_UINT8(4u, TKLSDLRCFG_LOAD_SUBWIN_CNT);
+}
+
+/**
+ * \brief Test that assert fires on attempt to get CPU load with incomplete
+ * initialization or of a task that is not within task list
+ */
+void test_TKLsdlrLoad_assertInvalidArgOnGetCpuLoad(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 1u,
+         .deadline = 1u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner}
+    };
+
+    TKLsdlr_utModTickSrcTskLst(NULL, tskLst, 1u);
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_getCpuLoad());
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_getTskCpuLoad(0u));
+
+    TKLtick_getTick_IgnoreAndReturn(0u);
+    TKLsdlr_utModTickSrcTskLst(&TKLtick_getTick, tskLst, 1u);
+    TEST_ASSERT_PASS_ASSERT(TKLsdlr_getTskCpuLoad(0u));
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_getTskCpuLoad(1u));
+}
+
+/**
+ * \brief Test that CPU load is measured over complete sub-windows, in total
+ * and per task
+ */
+void test_TKLsdlrLoad_measCpuLoad(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* Released at `10`, `20`, ..., 2 ticks execution time */
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0},
+        /* Released at `20`, `40`, ..., 1 tick execution time */
+        {.active = true,
+         .period = 20u,
+         .deadline = 20u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner1}
+    };
+
+    /* Start measurement (no task run), sub-window `[5, 15[` */
+    TKLtick_getTick_ExpectAndReturn(5u);
+
+    /* No sub-window complete yet */
+    TKLtick_getTick_ExpectAndReturn(12u);
+
+    /* Run task runner 0 in sub-window `[5, 15[` */
+    TKLtick_getTick_ExpectAndReturn(12u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(14u);
+
+    /* Run task runner 0 and 1 in sub-window `[15, 25[` */
+    TKLtick_getTick_ExpectAndReturn(20u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(22u);
+    TKLtick_getTick_ExpectAndReturn(22u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(23u);
+
+    /* 2 complete sub-windows: 5 of 20 ticks busy (task runner 0: 4,
+       task runner 1: 1) */
+    TKLtick_getTick_ExpectAndReturn(25u);
+    TKLtick_getTick_ExpectAndReturn(25u);
+    TKLtick_getTick_ExpectAndReturn(25u);
+
+    /* Long idle phase: all sub-windows complete without any busy time */
+    TKLtick_getTick_ExpectAndReturn(1000u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 2u);
+    TKLsdlr_exec();
+    TEST_ASSERT_EQUAL_UINT16(0u, TKLsdlr_getCpuLoad());
+    for (uint8_t i = 0u; i < 3; i++) {
+        TKLsdlr_exec();
+    }
+
+    TEST_ASSERT_EQUAL_UINT16(2500u, TKLsdlr_getCpuLoad());
+    TEST_ASSERT_EQUAL_UINT16(2000u, TKLsdlr_getTskCpuLoad(0u));
+    TEST_ASSERT_EQUAL_UINT16(500u, TKLsdlr_getTskCpuLoad(1u));
+
+    TEST_ASSERT_EQUAL_UINT16(0u, TKLsdlr_getCpuLoad());
+}
+
+#endif /* TEST */
@@ -0,0 +1,203 @@
+/** \file */
+
+#ifdef TEST
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "assert.h" /* Sanity checks (Design by Contract); replaced for unit
+                       testing */
+
+#include "unity.h"
+
+#include "TKLsdlr.h"
+
+#include "TKLtyp.h"
+#include "mock_TKLtick.h"
+
+#include "mock_TKLtsk.h"
+
+/* "Invisible" API for unit tests to modify internal state (private vars.) */
+extern void TKLsdlr_utModTickSrcTskLst(const TKLtyp_p_getTick_t p_getTick,
+                                       TKLtyp_tsk_t* const p_tskLst,
+                                       const uint8_t tskCnt);
+
+/* OPERATIONS
+ * ==========
+ */
+
+/** \brief Run before every test */
+void setUp(void) {
+    /* Do nothing */
+}
+
+/** \brief Run after every test */
+void tearDown(void) {
+    /* Reset internal state (private vars.) */
+    TKLsdlr_utModTickSrcTskLst(NULL, NULL, 0u);
+    TKLsdlr_clrTskOverrun();
+}
+
+/**
+ * \brief Test that a requested task list is only switched to at the start of
+ * the next cycle, and that no further request is accepted until then
+ */
+void test_TKLsdlrModeChg_reqTskLstSwitchAtCycleStart(void) {
+    TKLtyp_tsk_t tskLstA[] = {
+        /* .active, .period, .deadline, .lastRun, .p_tskRunner */
+        {true, 10u, 10u, 0u, &TKLtsk_runner0}
+    };
+    TKLtyp_tsk_t tskLstB[] = {
+        {true, 10u, 10u, 0u, &TKLtsk_runner1}
+    };
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLstA, 1u);
+
+    TEST_ASSERT_TRUE(TKLsdlr_reqTskLst(tskLstB, 1u, 0u));
+    TEST_ASSERT_FALSE(TKLsdlr_reqTskLst(tskLstA, 1u, 0u));
+    TEST_ASSERT_EQUAL_PTR(tskLstA, TKLsdlr_getTskLst());
+
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(11u);
+    TKLsdlr_exec();
+
+    TEST_ASSERT_EQUAL_PTR(tskLstB, TKLsdlr_getTskLst());
+    TEST_ASSERT_TRUE(TKLsdlr_reqTskLst(tskLstA, 1u, 0u));
+}
+
+/**
+ * \brief Test that tasks shared between task lists keep their phase, and that
+ * other tasks drop releases missed before the switch, but not one at the time
+ * of the switch
+ */
+void test_TKLsdlrModeChg_execCarryPhase(void) {
+    TKLtyp_tsk_t tskLstA[] = {
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0}
+    };
+    TKLtyp_tsk_t tskLstB[] = {
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner1},
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0},
+        {.active = true,
+         .period = 5u,
+         .deadline = 5u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner2}
+    };
+
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(11u);
+
+    TKLtick_getTick_ExpectAndReturn(35u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(35u);
+
+    TKLtick_getTick_ExpectAndReturn(36u);
+    TKLtsk_runner2_Expect();
+    TKLtick_getTick_ExpectAndReturn(36u);
+
+    TKLtick_getTick_ExpectAndReturn(40u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(41u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLstA, 1u);
+    TKLsdlr_exec();
+
+    TEST_ASSERT_TRUE(TKLsdlr_reqTskLst(tskLstB, 3u, 0u));
+    TKLsdlr_exec();
+
+    /* Shared task continued from `lastRun` of `10`, others rebased */
+    TEST_ASSERT_EQUAL_UINT32(30u, tskLstB[0].lastRun);
+    TEST_ASSERT_EQUAL_UINT32(30u, tskLstB[1].lastRun);
+    TEST_ASSERT_EQUAL_UINT32(30u, tskLstB[2].lastRun);
+
+    TKLsdlr_exec();
+    TKLsdlr_exec();
+
+    TEST_ASSERT_EQUAL_UINT8(0u, TKLsdlr_cntTskOverrun());
+}
+
+/**
+ * \brief Test that a task list switch with hyperperiod is delayed until the
+ * next multiple of the hyperperiod
+ */
+void test_TKLsdlrModeChg_execSwitchAtHyperperiod(void) {
+    TKLtyp_tsk_t tskLstA[] = {
+        /* .active, .period, .deadline, .lastRun, .p_tskRunner */
+        {true, 100u, 100u, 0u, &TKLtsk_runner0}
+    };
+    TKLtyp_tsk_t tskLstB[] = {
+        {true, 10u, 10u, 0u, &TKLtsk_runner1}
+    };
+
+    TKLtick_getTick_ExpectAndReturn(25u);
+    TKLtick_getTick_ExpectAndReturn(39u);
+    TKLtick_getTick_ExpectAndReturn(40u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(41u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLstA, 1u);
+    TEST_ASSERT_TRUE(TKLsdlr_reqTskLst(tskLstB, 1u, 20u));
+
+    TKLsdlr_exec();
+    TEST_ASSERT_EQUAL_PTR(tskLstA, TKLsdlr_getTskLst());
+    TKLsdlr_exec();
+    TEST_ASSERT_EQUAL_PTR(tskLstA, TKLsdlr_getTskLst());
+    TKLsdlr_exec();
+    TEST_ASSERT_EQUAL_PTR(tskLstB, TKLsdlr_getTskLst());
+    TEST_ASSERT_EQUAL_UINT32(40u, tskLstB[0].lastRun);
+}
+
+/**
+ * \brief Test that a task list switch with hyperperiod (not a power of 2) is
+ * delayed until the next multiple of the hyperperiod counted from `0` also
+ * after a time tick count rollover
+ */
+void test_TKLsdlrModeChg_execSwitchAtHyperperiodOnTickRollover(void) {
+    TKLtyp_tsk_t tskLstA[] = {
+        /* .active, .period, .deadline, .lastRun, .p_tskRunner */
+        {true, 100u, 100u, TKLTYP_TICK_MAX - 50u, &TKLtsk_runner0}
+    };
+    TKLtyp_tsk_t tskLstB[] = {
+        {true, 3u, 3u, 2u, &TKLtsk_runner1}
+    };
+
+    TKLtick_getTick_ExpectAndReturn(TKLTYP_TICK_MAX - 2u);
+    TKLtick_getTick_ExpectAndReturn(3u); /* Rollover */
+    TKLtick_getTick_ExpectAndReturn(4u);
+    /* Time tick count since `0` is `2^32 + 5`, a multiple of `3` (`3` would
+       be without rollover) */
+    TKLtick_getTick_ExpectAndReturn(5u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(5u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLstA, 1u);
+
+    TKLsdlr_exec();
+    TEST_ASSERT_TRUE(TKLsdlr_reqTskLst(tskLstB, 1u, 3u));
+    TKLsdlr_exec();
+    TEST_ASSERT_EQUAL_PTR(tskLstA, TKLsdlr_getTskLst());
+    TKLsdlr_exec();
+    TEST_ASSERT_EQUAL_PTR(tskLstA, TKLsdlr_getTskLst());
+    TKLsdlr_exec();
+    TEST_ASSERT_EQUAL_PTR(tskLstB, TKLsdlr_getTskLst());
+}
+
+#endif /* TEST */
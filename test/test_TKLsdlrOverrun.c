@@ -0,0 +1,208 @@
+/** \file */
+
+#ifdef TEST
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "assert.h" /* Sanity checks (Design by Contract); replaced for unit
+                       testing */
+
+#include "unity.h"
+
+#include "TKLsdlr.h"
+
+#include "TKLtyp.h"
+#include "mock_TKLtick.h"
+
+#include "mock_TKLtsk.h"
+
+/* "Invisible" API for unit tests to modify internal state (private vars.) */
+extern void TKLsdlr_utModTickSrcTskLst(const TKLtyp_p_getTick_t p_getTick,
+                                       TKLtyp_tsk_t* const p_tskLst,
+                                       const uint8_t tskCnt);
+
+/* OPERATIONS
+ * ==========
+ */
+
+/** \brief Run before every test */
+void setUp(void) {
+    /* Do nothing */
+}
+
+/** \brief Run after every test */
+void tearDown(void) {
+    /* Reset internal state (private vars.) */
+    TKLsdlr_utModTickSrcTskLst(NULL, NULL, 0u);
+    TKLsdlr_clrTskOverrun();
+}
+
+/**
+ * \brief Test that per-task deadline overrun recording is enabled for this test
+ * file (with 8 bit counters)
+ */
+void test_TKLsdlrOverrun_checkTskOverrunIsEna(void) {
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLSDLRCFG_TSK_OVERRUN_ENA);
+    TEST_ASSERT_EQUAL_UINT8(8u, TKLSDLRCFG_TSK_OVERRUN_CNT_WIDTH);
+}
+
+/**
+ * \brief Test that assert fires on attempt to get deadline overrun record of a
+ * task that is not within task list or without destination
+ */
+void test_TKLsdlrOverrun_assertInvalidArgOnGetTskOverrun(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 1u,
+         .deadline = 1u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner}
+    };
+    TKLtyp_tskOverrun_t tskOverrun;
+
+    TKLsdlr_utModTickSrcTskLst(&TKLtick_getTick, tskLst, 1u);
+    TEST_ASSERT_PASS_ASSERT(TKLsdlr_getTskOverrun(0u, &tskOverrun));
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_getTskOverrun(1u, &tskOverrun));
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_getTskOverrun(0u, NULL));
+}
+
+/**
+ * \brief Test that deadline overruns are recorded for the offending task only
+ * (in addition to the aggregate counter)
+ */
+void test_TKLsdlrOverrun_recTskOverrunPerTsk(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* Released at `10`, `20`, ... */
+        {.active = true,
+         .period = 10u,
+         .deadline = 5u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0},
+        /* Released at `10`, `20`, ... */
+        {.active = true,
+         .period = 10u,
+         .deadline = 5u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner1}
+    };
+    TKLtyp_tskOverrun_t tskOverrun;
+
+    /* Task runner 0 in time, task runner 1 overruns by 3 */
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(12u);
+    TKLtick_getTick_ExpectAndReturn(12u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(18u);
+
+    /* Task runner 0 in time, task runner 1 overruns by 1 */
+    TKLtick_getTick_ExpectAndReturn(20u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(21u);
+    TKLtick_getTick_ExpectAndReturn(21u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(26u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 2u);
+    for (uint8_t i = 0u; i < 4; i++) {
+        TKLsdlr_exec();
+    }
+
+    TEST_ASSERT_EQUAL_UINT8(2u, TKLsdlr_cntTskOverrun());
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLsdlr_getLastOverrunTsk());
+
+    TKLsdlr_getTskOverrun(0u, &tskOverrun);
+    TEST_ASSERT_EQUAL_UINT32(0u, tskOverrun.cnt);
+    TEST_ASSERT_EQUAL_UINT32(0u, tskOverrun.lastTick);
+    TEST_ASSERT_EQUAL_UINT32(0u, tskOverrun.worstLateness);
+
+    TKLsdlr_getTskOverrun(1u, &tskOverrun);
+    TEST_ASSERT_EQUAL_UINT32(2u, tskOverrun.cnt);
+    TEST_ASSERT_EQUAL_UINT32(26u, tskOverrun.lastTick);
+    TEST_ASSERT_EQUAL_UINT32(3u, tskOverrun.worstLateness);
+}
+
+/**
+ * \brief Test if per-task deadline overrun counter gets correctly saturated
+ * at max. value of configured width (instead of rolling over)
+ */
+void test_TKLsdlrOverrun_saturateTskOverrunPerTsk(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 100u,
+         .deadline = 10u,
+         .lastRun = TKLTYP_CALC_OFFSET(100u, 0u),
+         .p_tskRunner = &TKLtsk_runner}
+    };
+    TKLtyp_tskOverrun_t tskOverrun;
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 1u);
+
+    /* Run more scheduler exec. cycles with task overruns than task deadline
+       overrun counter can hold so it gets saturated */
+    for (uint16_t i = 0u; i < UINT8_MAX + 3u; i++) {
+        /* Task overruns */
+        TKLtick_getTick_ExpectAndReturn(tskLst[0].period * i);
+        TKLtsk_runner_Expect();
+        TKLtick_getTick_ExpectAndReturn((tskLst[0].period * i)
+                                        + tskLst[0].deadline + 1u);
+
+        TKLsdlr_exec();
+    }
+
+    TKLsdlr_getTskOverrun(0u, &tskOverrun);
+    TEST_ASSERT_EQUAL_UINT32(UINT8_MAX, tskOverrun.cnt);
+    TEST_ASSERT_EQUAL_UINT32(100u * (UINT8_MAX + 2u) + 11u,
+                             tskOverrun.lastTick);
+    TEST_ASSERT_EQUAL_UINT32(1u, tskOverrun.worstLateness);
+}
+
+/**
+ * \brief Test if per-task deadline overrun records are reset together with
+ * aggregate counter and on task list registration
+ */
+void test_TKLsdlrOverrun_clearTskOverrunPerTsk(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner}
+    };
+    TKLtyp_tskOverrun_t tskOverrun;
+
+    /* Task overruns (twice) */
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLtsk_runner_Expect();
+    TKLtick_getTick_ExpectAndReturn(21u);
+    TKLtick_getTick_ExpectAndReturn(30u);
+    TKLtsk_runner_Expect();
+    TKLtick_getTick_ExpectAndReturn(41u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 1u);
+    TKLsdlr_exec();
+
+    TKLsdlr_getTskOverrun(0u, &tskOverrun);
+    TEST_ASSERT_EQUAL_UINT32(1u, tskOverrun.cnt);
+
+    TKLsdlr_clrTskOverrun();
+    TKLsdlr_getTskOverrun(0u, &tskOverrun);
+    TEST_ASSERT_EQUAL_UINT32(0u, tskOverrun.cnt);
+    TEST_ASSERT_EQUAL_UINT32(0u, tskOverrun.lastTick);
+    TEST_ASSERT_EQUAL_UINT32(0u, tskOverrun.worstLateness);
+
+    TKLsdlr_exec();
+    TKLsdlr_getTskOverrun(0u, &tskOverrun);
+    TEST_ASSERT_EQUAL_UINT32(1u, tskOverrun.cnt);
+
+    TKLsdlr_setTskLst(tskLst, 1u);
+    TKLsdlr_getTskOverrun(0u, &tskOverrun);
+    TEST_ASSERT_EQUAL_UINT32(0u, tskOverrun.cnt);
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLsdlr_cntTskOverrun()); /* Not reset */
+}
+
+#endif /* TEST */
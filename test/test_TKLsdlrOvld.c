@@ -0,0 +1,171 @@
+/** \file */
+
+#ifdef TEST
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "assert.h" /* Sanity checks (Design by Contract); replaced for unit
+                       testing */
+
+#include "unity.h"
+
+#include "TKLsdlr.h"
+
+#include "TKLtyp.h"
+#include "mock_TKLtick.h"
+
+#include "mock_TKLtsk.h"
+
+/* "Invisible" API for unit tests to modify internal state (private vars.) */
+extern void TKLsdlr_utModTickSrcTskLst(const TKLtyp_p_getTick_t p_getTick,
+                                       TKLtyp_tsk_t* const p_tskLst,
+                                       const uint8_t tskCnt);
+
+/* OPERATIONS
+ * ==========
+ */
+
+/** \brief Run before every test */
+void setUp(void) {
+    /* Do nothing */
+}
+
+/** \brief Run after every test */
+void tearDown(void) {
+    /* Reset internal state (private vars.) */
+    TKLsdlr_utModTickSrcTskLst(NULL, NULL, 0u);
+    TKLsdlr_clrTskOverrun();
+}
+
+/**
+ * \brief Test that there is no overload initially and that criticality levels
+ * can only be set for tasks within task list
+ */
+void test_TKLsdlrOvld_setTskCrit(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* .active, .period, .deadline, .lastRun, .p_tskRunner */
+        {true, 10u, 10u, 0u, &TKLtsk_runner0},
+        {true, 10u, 10u, 0u, &TKLtsk_runner1}
+    };
+
+    TKLsdlr_setTskLst(tskLst, 2u);
+    TKLsdlr_setTskCrit(1u, 2u);
+
+    TEST_ASSERT_EQUAL_UINT8(0u, TKLsdlr_getOvldLvl());
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_setTskCrit(2u, 1u));
+}
+
+/**
+ * \brief Test that too many deadline overruns within a window shed tasks of
+ * low criticality, and that they are run again after a window without
+ * overruns
+ */
+void test_TKLsdlrOvld_execShedAndRestore(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 10u,
+         .deadline = 6u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0},
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner1}
+    };
+
+    /* Two overruns (`TKLSDLRCFG_OVLD_OVERRUN_MAX`) of critical task */
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(17u);
+
+    TKLtick_getTick_ExpectAndReturn(17u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(17u);
+
+    TKLtick_getTick_ExpectAndReturn(20u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(27u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 2u);
+    TKLsdlr_setTskCrit(0u, 1u);
+    TKLsdlr_exec();
+    TKLsdlr_exec();
+    TKLsdlr_exec();
+
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLsdlr_getOvldLvl());
+
+    /* Non-critical task shed, critical one still run */
+    TKLtick_getTick_ExpectAndReturn(27u);
+
+    TKLtick_getTick_ExpectAndReturn(30u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(30u);
+
+    TKLtick_getTick_ExpectAndReturn(30u);
+
+    TKLsdlr_exec();
+    TKLsdlr_exec();
+    TKLsdlr_exec();
+
+    TEST_ASSERT_EQUAL_UINT32(30u, tskLst[1].lastRun);
+
+    /* Window (`TKLSDLRCFG_OVLD_WIN`) without overruns */
+    TKLtick_getTick_ExpectAndReturn(131u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(131u);
+
+    TKLtick_getTick_ExpectAndReturn(131u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(131u);
+
+    TKLsdlr_exec();
+
+    TEST_ASSERT_EQUAL_UINT8(0u, TKLsdlr_getOvldLvl());
+
+    TKLsdlr_exec();
+
+    TEST_ASSERT_EQUAL_UINT8(2u, TKLsdlr_cntTskOverrun());
+}
+
+/**
+ * \brief Test that tasks of the highest criticality within task list are never
+ * shed
+ */
+void test_TKLsdlrOvld_execNoShedOfHighestCrit(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* .active, .period, .deadline, .lastRun, .p_tskRunner */
+        {true, 10u, 1u, 0u, &TKLtsk_runner0},
+        {true, 10u, 1u, 0u, &TKLtsk_runner1}
+    };
+
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(12u);
+
+    TKLtick_getTick_ExpectAndReturn(12u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(14u);
+
+    TKLtick_getTick_ExpectAndReturn(20u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(22u);
+
+    TKLtick_getTick_ExpectAndReturn(22u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(24u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 2u);
+    TKLsdlr_exec();
+    TKLsdlr_exec();
+    TKLsdlr_exec();
+    TKLsdlr_exec();
+
+    TEST_ASSERT_EQUAL_UINT8(4u, TKLsdlr_cntTskOverrun());
+    TEST_ASSERT_EQUAL_UINT8(0u, TKLsdlr_getOvldLvl());
+}
+
+#endif /* TEST */
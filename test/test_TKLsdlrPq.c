@@ -0,0 +1,247 @@
+/** \file */
+
+#ifdef TEST
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "assert.h" /* Sanity checks (Design by Contract); replaced for unit
+                       testing */
+
+#include "unity.h"
+
+#include "TKLsdlr.h"
+
+#include "TKLtyp.h"
+#include "mock_TKLtick.h"
+
+#include "mock_TKLtsk.h"
+
+/* "Invisible" API for unit tests to modify internal state (private vars.) */
+extern void TKLsdlr_utModTickSrcTskLst(const TKLtyp_p_getTick_t p_getTick,
+                                       TKLtyp_tsk_t* const p_tskLst,
+                                       const uint8_t tskCnt);
+
+/* OPERATIONS
+ * ==========
+ */
+
+/** \brief Run before every test */
+void setUp(void) {
+    /* Do nothing */
+}
+
+/** \brief Run after every test */
+void tearDown(void) {
+    /* Reset internal state (private vars.) */
+    TKLsdlr_utModTickSrcTskLst(NULL, NULL, 0u);
+    TKLsdlr_clrTskOverrun();
+}
+
+/** \brief Test that priority queue engine is enabled for this test file */
+void test_TKLsdlrPq_checkPqEngineIsEna(void) {
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLSDLRCFG_PQ_ENA);
+}
+
+/**
+ * \brief Test that assert fires on attempt to set task list with more tasks
+ * than the priority queue can hold
+ */
+void test_TKLsdlrPq_assertTskCntNotAboveMaxOnSetTskLst(void) {
+#define TSK {true, 1u, 1u, 0u, &TKLtsk_runner}
+    TKLtyp_tsk_t tskLst[] = {
+        TSK, TSK, TSK, TSK, TSK, TSK, TSK, TSK,
+        TSK, TSK, TSK, TSK, TSK, TSK, TSK, TSK,
+        TSK
+    };
+#undef TSK
+
+    /* Task list must be exactly 1 task too long for the configured max. */
+    TEST_ASSERT_EQUAL_UINT8(TKLSDLRCFG_TSK_CNT_MAX + 1u,
+                            sizeof(tskLst) / sizeof(*tskLst));
+
+    TEST_ASSERT_PASS_ASSERT(TKLsdlr_setTskLst(tskLst,
+                                              TKLSDLRCFG_TSK_CNT_MAX));
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_setTskLst(tskLst,
+                                              TKLSDLRCFG_TSK_CNT_MAX + 1u));
+}
+
+/**
+ * \brief Test that only the tick count is read if no task is due to run
+ *
+ * If any task runner is run, test will fail (as it should), complaining that
+ * it is called more times than expected.
+ */
+void test_TKLsdlrPq_checkNoTskIsTouchedIfNoneIsDue(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* .active, .period, .deadline, .lastRun, .p_tskRunner */
+        {true, 10u, 10u, 0u, &TKLtsk_runner0},
+        {true, 20u, 20u, 0u, &TKLtsk_runner1},
+        {false, 5u, 5u, 0u, &TKLtsk_runner2}
+    };
+
+    TKLtick_getTick_ExpectAndReturn(4u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 3u);
+    TKLsdlr_exec();
+
+    TEST_ASSERT_EQUAL_UINT32(0u, tskLst[2].lastRun);
+}
+
+/**
+ * \brief Test that due-to-run tasks are run in task list order, independent
+ * of which one was released first
+ */
+void test_TKLsdlrPq_execDueToRunTskInTskLstOrder(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* Released at `9` */
+        {.active = true,
+         .period = 9u,
+         .deadline = 9u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0},
+        /* Released at `3` */
+        {.active = true,
+         .period = 3u,
+         .deadline = 9u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner1},
+        /* Released at `5` */
+        {.active = true,
+         .period = 5u,
+         .deadline = 9u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner2}
+    };
+
+    /* Run task runner 0, 1, 2 */
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLtsk_runner2_Expect();
+    TKLtick_getTick_ExpectAndReturn(10u);
+
+    /* Run task runner 1 */
+    TKLtick_getTick_ExpectAndReturn(12u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(12u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 3u);
+    for (uint8_t i = 0u; i < 4; i++) {
+        TKLsdlr_exec();
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(9u, tskLst[0].lastRun);
+    TEST_ASSERT_EQUAL_UINT32(12u, tskLst[1].lastRun);
+    TEST_ASSERT_EQUAL_UINT32(10u, tskLst[2].lastRun);
+}
+
+/**
+ * \brief Test that `lastRun` value of disabled task with higher priority than
+ * run task is still updated, but not the one with lower priority
+ */
+void test_TKLsdlrPq_checkLastRunOfDisTskIsStillUpdated(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* .active, .period, .deadline, .lastRun, .p_tskRunner */
+        {false, 10u, 10u, 0u, &TKLtsk_runner0},
+        {true, 10u, 10u, 0u, &TKLtsk_runner1},
+        {false, 10u, 10u, 0u, &TKLtsk_runner2}
+    };
+
+    TKLtick_getTick_ExpectAndReturn(327u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(327u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 3u);
+    TKLsdlr_exec();
+
+    TEST_ASSERT_EQUAL_UINT32(320u, tskLst[0].lastRun);
+    TEST_ASSERT_EQUAL_UINT32(320u, tskLst[1].lastRun);
+    TEST_ASSERT_EQUAL_UINT32(0u, tskLst[2].lastRun);
+}
+
+/**
+ * \brief Test that updating the time stamp of last task run re-schedules the
+ * task
+ */
+void test_TKLsdlrPq_reschedTskOnUpdateLastRun(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* .active, .period, .deadline, .lastRun, .p_tskRunner */
+        {true, 10u, 10u, 0u, &TKLtsk_runner0},
+        {false, 10u, 10u, 0u, &TKLtsk_runner1}
+    };
+
+    /* Timer (task runner 1) started at `5` */
+    TKLtick_getTick_ExpectAndReturn(5u);
+
+    /* Run task runner 0 */
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(10u);
+
+    /* Run no task runner */
+    TKLtick_getTick_ExpectAndReturn(14u);
+
+    /* Run task runner 1 */
+    TKLtick_getTick_ExpectAndReturn(15u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(15u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 2u);
+    TKLsdlr_setTskAct(TKLtsk_runner1, true, true);
+    for (uint8_t i = 0u; i < 3; i++) {
+        TKLsdlr_exec();
+    }
+}
+
+/**
+ * \brief Test correct execution of multiple due-to-run tasks with different
+ * time tick periods on relative system time tick count rollover
+ */
+void test_TKLsdlrPq_execDueToRunTskAtDiffPeriodOnTickRollover(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* .active, .period, .deadline, .lastRun, .p_tskRunner */
+        {true, 4u, 4u, UINT32_MAX - 3u, &TKLtsk_runner0},
+        {true, 3u, 3u, UINT32_MAX - 1u, &TKLtsk_runner1}
+    };
+
+    /* Run no task runner */
+    TKLtick_getTick_ExpectAndReturn(UINT32_MAX); /* `4294967295` */
+
+    /* Run task runner 0 */
+    TKLtick_getTick_ExpectAndReturn(UINT32_MAX + 1u); /* `0` */
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(UINT32_MAX + 1u);
+
+    /* Run task runner 1 */
+    TKLtick_getTick_ExpectAndReturn(UINT32_MAX + 2u); /* `1` */
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(UINT32_MAX + 2u);
+
+    /* Run no task runner */
+    TKLtick_getTick_ExpectAndReturn(UINT32_MAX + 4u); /* `3` */
+
+    /* Run task runner 0, 1 */
+    TKLtick_getTick_ExpectAndReturn(UINT32_MAX + 5u); /* `4` */
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(UINT32_MAX + 5u);
+    TKLtick_getTick_ExpectAndReturn(UINT32_MAX + 5u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(UINT32_MAX + 5u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 2u);
+    for (uint8_t i = 0u; i < 6; i++) {
+        TKLsdlr_exec();
+    }
+}
+
+#endif /* TEST */
@@ -0,0 +1,141 @@
+/** \file */
+
+#ifdef TEST
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "assert.h" /* Sanity checks (Design by Contract); replaced for unit
+                       testing */
+
+#include "unity.h"
+
+#include "TKLsdlr.h"
+
+#include "TKLtyp.h"
+#include "mock_TKLtick.h"
+
+#include "mock_TKLtsk.h"
+
+/* "Invisible" API for unit tests to modify internal state (private vars.) */
+extern void TKLsdlr_utModTickSrcTskLst(const TKLtyp_p_getTick_t p_getTick,
+                                       TKLtyp_tsk_t* const p_tskLst,
+                                       const uint8_t tskCnt);
+
+/* OPERATIONS
+ * ==========
+ */
+
+/** \brief Run before every test */
+void setUp(void) {
+    /* Do nothing */
+}
+
+/** \brief Run after every test */
+void tearDown(void) {
+    /* Reset internal state (private vars.) */
+    TKLsdlr_utModTickSrcTskLst(NULL, NULL, 0u);
+    TKLsdlr_clrTskOverrun();
+}
+
+
+/**
+ * \brief Test that release time catches up on lost periods for power of 2
+ * and other periods, without any period lost, and up to the max. time span
+ * since last task run
+ */
+void test_TKLsdlrRelRecip_execCatchUpRel(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 8u,
+         .deadline = 8u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0},
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner1},
+        {.active = true,
+         .period = 7u,
+         .deadline = 7u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner2}
+    };
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 3u);
+
+    TKLtick_getTick_ExpectAndReturn(45u); /* Power of 2, periods lost */
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(45u);
+    TKLsdlr_exec();
+    TEST_ASSERT_EQUAL_UINT32(40u, tskLst[0].lastRun);
+
+    TKLtick_getTick_ExpectAndReturn(45u); /* Other period, periods lost */
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(45u);
+    TKLsdlr_exec();
+    TEST_ASSERT_EQUAL_UINT32(40u, tskLst[1].lastRun);
+
+    tskLst[0].active = false;
+    tskLst[1].active = false;
+
+    TKLtick_getTick_ExpectAndReturn(UINT32_MAX); /* Max. time span */
+    TKLtsk_runner2_Expect();
+    TKLtick_getTick_ExpectAndReturn(UINT32_MAX);
+    TKLsdlr_exec();
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX - 3u, tskLst[2].lastRun);
+
+    tskLst[1].active = true;
+    tskLst[2].active = false;
+
+    /* Disabled task kept aligned (`lastRun` is `UINT32_MAX - 5u`) */
+    TKLtick_getTick_ExpectAndReturn(58u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(58u);
+    TKLsdlr_exec();
+    TEST_ASSERT_EQUAL_UINT32(54u, tskLst[1].lastRun);
+
+    TKLtick_getTick_ExpectAndReturn(66u); /* No period lost */
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(66u);
+    TKLsdlr_exec();
+    TEST_ASSERT_EQUAL_UINT32(64u, tskLst[1].lastRun);
+}
+
+/**
+ * \brief Test that release time catches up on lost periods across time tick
+ * count rollover
+ */
+void test_TKLsdlrRelRecip_execCatchUpRelOnTickRollover(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 1000u,
+         .deadline = 1000u,
+         .lastRun = UINT32_MAX - 500u,
+         .p_tskRunner = &TKLtsk_runner0},
+        {.active = true,
+         .period = 1024u,
+         .deadline = 1024u,
+         .lastRun = UINT32_MAX - 500u,
+         .p_tskRunner = &TKLtsk_runner1}
+    };
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 2u);
+
+    TKLtick_getTick_ExpectAndReturn(2600u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(2600u);
+    TKLsdlr_exec();
+    TEST_ASSERT_EQUAL_UINT32(2499u, tskLst[0].lastRun);
+
+    TKLtick_getTick_ExpectAndReturn(2600u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(2600u);
+    TKLsdlr_exec();
+    TEST_ASSERT_EQUAL_UINT32(2571u, tskLst[1].lastRun);
+}
+
+#endif /* TEST */
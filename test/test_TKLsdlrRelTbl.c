@@ -0,0 +1,335 @@
+/** \file */
+
+#ifdef TEST
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "assert.h" /* Sanity checks (Design by Contract); replaced for unit
+                       testing */
+
+#include "unity.h"
+
+#include "TKLsdlr.h"
+
+#include "TKLtyp.h"
+#include "mock_TKLtick.h"
+
+#include "mock_TKLtsk.h"
+
+/* "Invisible" API for unit tests to modify internal state (private vars.) */
+extern void TKLsdlr_utModTickSrcTskLst(const TKLtyp_p_getTick_t p_getTick,
+                                       TKLtyp_tsk_t* const p_tskLst,
+                                       const uint8_t tskCnt);
+
+/* ATTRIBUTES
+ * ==========
+ */
+
+/**
+ * \brief Release table for task list with periods `30`, `40`, `90` and
+ * offsets `10`, `30`, `90`
+ *
+ * As generated by `util/rel-tbl-gen.py`.
+ */
+static const TKLtyp_relSlot_t pv_relSlot[] = {
+    {0u, 0x00000004u},
+    {10u, 0x00000001u},
+    {30u, 0x00000002u},
+    {40u, 0x00000001u},
+    {70u, 0x00000003u},
+    {90u, 0x00000004u},
+    {100u, 0x00000001u},
+    {110u, 0x00000002u},
+    {130u, 0x00000001u},
+    {150u, 0x00000002u},
+    {160u, 0x00000001u},
+    {180u, 0x00000004u},
+    {190u, 0x00000003u},
+    {220u, 0x00000001u},
+    {230u, 0x00000002u},
+    {250u, 0x00000001u},
+    {270u, 0x00000006u},
+    {280u, 0x00000001u},
+    {310u, 0x00000003u},
+    {340u, 0x00000001u},
+    {350u, 0x00000002u}
+};
+static const TKLtyp_tick_t pv_relPeriod[] = {30u, 40u, 90u};
+static const TKLtyp_tick_t pv_relOffset[] = {10u, 30u, 90u};
+static const TKLtyp_relTbl_t pv_relTbl = {
+    .hyperperiod = 360u,
+    .slotCnt = 21u,
+    .p_slot = pv_relSlot,
+    .tskCnt = 3u,
+    .p_period = pv_relPeriod,
+    .p_offset = pv_relOffset
+};
+
+/** \brief Release table with hyperperiod exceeding half the tick range */
+static const TKLtyp_relTbl_t pv_relTblLongHp = {
+    .hyperperiod = (TKLTYP_TICK_MAX / 2u) + 1u,
+    .slotCnt = 21u,
+    .p_slot = pv_relSlot,
+    .tskCnt = 3u,
+    .p_period = pv_relPeriod,
+    .p_offset = pv_relOffset
+};
+
+/* OPERATIONS
+ * ==========
+ */
+
+/** \brief Run before every test */
+void setUp(void) {
+    /* Do nothing */
+}
+
+/** \brief Run after every test */
+void tearDown(void) {
+    /* Reset internal state (private vars.) */
+    TKLsdlr_utModTickSrcTskLst(NULL, NULL, 0u);
+    TKLsdlr_clrTskOverrun();
+}
+
+/**
+ * \brief Test that assert fires on attempt to set release table to `NULL` or
+ * one that does not match registered task list
+ */
+void test_TKLsdlrRelTbl_assertMatchingRelTblOnSetRelTbl(void) {
+    TKLtyp_tsk_t tskLstA[] = {
+        /* .active, .period, .deadline, .lastRun, .p_tskRunner */
+        {true, 30u, 30u, TKLTYP_CALC_OFFSET(30u, 10u), &TKLtsk_runner0},
+        {true, 40u, 40u, TKLTYP_CALC_OFFSET(40u, 30u), &TKLtsk_runner1},
+        {true, 90u, 90u, 0u, &TKLtsk_runner2}
+    };
+    TKLtyp_tsk_t tskLstB[] = { /* Wrong period */
+        /* .active, .period, .deadline, .lastRun, .p_tskRunner */
+        {true, 30u, 30u, TKLTYP_CALC_OFFSET(30u, 10u), &TKLtsk_runner0},
+        {true, 45u, 40u, TKLTYP_CALC_OFFSET(45u, 30u), &TKLtsk_runner1},
+        {true, 90u, 90u, 0u, &TKLtsk_runner2}
+    };
+    TKLtyp_tsk_t tskLstC[] = { /* Wrong offset */
+        /* .active, .period, .deadline, .lastRun, .p_tskRunner */
+        {true, 30u, 30u, TKLTYP_CALC_OFFSET(30u, 10u), &TKLtsk_runner0},
+        {true, 40u, 40u, TKLTYP_CALC_OFFSET(40u, 30u), &TKLtsk_runner1},
+        {true, 90u, 90u, TKLTYP_CALC_OFFSET(90u, 10u), &TKLtsk_runner2}
+    };
+
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_setRelTbl(&pv_relTbl)); /* Task list not
+                                                              set */
+
+    TKLsdlr_setTskLst(tskLstA, 3u);
+
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_setRelTbl(NULL));
+
+    TKLsdlr_setTskLst(tskLstA, 2u); /* Wrong task count */
+
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_setRelTbl(&pv_relTbl));
+
+    TKLsdlr_setTskLst(tskLstB, 3u);
+
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_setRelTbl(&pv_relTbl));
+
+    TKLsdlr_setTskLst(tskLstC, 3u);
+
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_setRelTbl(&pv_relTbl));
+
+    TKLsdlr_setTskLst(tskLstA, 3u);
+
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_setRelTbl(&pv_relTblLongHp));
+
+    TKLsdlr_setTskLst(tskLstA, 3u);
+
+    TEST_ASSERT_PASS_ASSERT(TKLsdlr_setRelTbl(&pv_relTbl));
+}
+
+/**
+ * \brief Test that assert fires on attempt to execute release table driven
+ * scheduler cycle without release table (also after task list switch)
+ */
+void test_TKLsdlrRelTbl_assertRelTblOnExecTbl(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* .active, .period, .deadline, .lastRun, .p_tskRunner */
+        {true, 30u, 30u, TKLTYP_CALC_OFFSET(30u, 10u), &TKLtsk_runner0},
+        {true, 40u, 40u, TKLTYP_CALC_OFFSET(40u, 30u), &TKLtsk_runner1},
+        {true, 90u, 90u, 0u, &TKLtsk_runner2}
+    };
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 3u);
+
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_execTbl());
+
+    TKLsdlr_setRelTbl(&pv_relTbl);
+    TKLsdlr_setTskLst(tskLst, 3u); /* Drops release table */
+
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_execTbl());
+}
+
+/**
+ * \brief Test that assert fires on attempt to update time stamp of last task
+ * run while release table is registered
+ */
+void test_TKLsdlrRelTbl_assertNoUpdateLastRunOnSetTskAct(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* .active, .period, .deadline, .lastRun, .p_tskRunner */
+        {true, 30u, 30u, TKLTYP_CALC_OFFSET(30u, 10u), &TKLtsk_runner0},
+        {true, 40u, 40u, TKLTYP_CALC_OFFSET(40u, 30u), &TKLtsk_runner1},
+        {true, 90u, 90u, 0u, &TKLtsk_runner2}
+    };
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 3u);
+    TKLsdlr_setRelTbl(&pv_relTbl);
+
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_setTskAct(&TKLtsk_runner0, true, true));
+    TEST_ASSERT_PASS_ASSERT(TKLsdlr_setTskAct(&TKLtsk_runner0, false, false));
+
+    TEST_ASSERT_FALSE(tskLst[0].active);
+}
+
+/**
+ * \brief Test correct execution of multiple due-to-run tasks with different
+ * time tick periods and offsets and start at 0 time ticks
+ *
+ * Same schedule as with \ref TKLsdlr_exec().
+ */
+void test_TKLsdlrRelTbl_execDueToRunTskAtDiffPeriodAndOffsetOn0TickStart(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* Run at: `10`, `40`, `70`, `100`, ... */
+        {.active = true,
+         .period = 30u,
+         .deadline = 30u,
+         .lastRun = TKLTYP_CALC_OFFSET(30u, 10u),
+         .p_tskRunner = &TKLtsk_runner0},
+        /* Run at: `30`, `70`, `110`, ... */
+        {.active = true,
+         .period = 40u,
+         .deadline = 40u,
+         .lastRun = TKLTYP_CALC_OFFSET(40u, 30u),
+         .p_tskRunner = &TKLtsk_runner1},
+        /* Run at: `90`, `180`, ... */
+        {.active = true,
+         .period = 90u,
+         .deadline = 90u,
+         .lastRun = 0u, /* Offset `0 + 90` */
+         .p_tskRunner = &TKLtsk_runner2}
+    };
+
+    /* Run no task runner (release slot at `0` is before first release) */
+    TKLtick_getTick_ExpectAndReturn(0u);
+
+    /* Run no task runner */
+    TKLtick_getTick_ExpectAndReturn(9u);
+
+    /* Run task runner 0 */
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(10u);
+
+    /* Run task runner 1 */
+    TKLtick_getTick_ExpectAndReturn(30u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(30u);
+
+    /* Run task runner 0, 1 */
+    TKLtick_getTick_ExpectAndReturn(70u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(70u);
+    TKLtick_getTick_ExpectAndReturn(70u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(70u);
+
+    /* Run no task runner */
+    TKLtick_getTick_ExpectAndReturn(89u);
+
+    /* Run task runner 2 */
+    TKLtick_getTick_ExpectAndReturn(90u);
+    TKLtsk_runner2_Expect();
+    TKLtick_getTick_ExpectAndReturn(90u);
+
+    /* Run task runner 0 (released at `610`), 1, 2 in next hyperperiod (`360`
+       + `270`) */
+    TKLtick_getTick_ExpectAndReturn(630u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(630u);
+    TKLtick_getTick_ExpectAndReturn(630u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(630u);
+    TKLtick_getTick_ExpectAndReturn(630u);
+    TKLtsk_runner2_Expect();
+    TKLtick_getTick_ExpectAndReturn(630u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 3u);
+    TKLsdlr_setRelTbl(&pv_relTbl);
+    for (uint8_t i = 0u; i < 11; i++) {
+        TKLsdlr_execTbl();
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(610u, tskLst[0].lastRun);
+    TEST_ASSERT_EQUAL_UINT32(630u, tskLst[1].lastRun);
+    TEST_ASSERT_EQUAL_UINT32(630u, tskLst[2].lastRun);
+}
+
+/**
+ * \brief Test that tasks are run only once and `lastRun` is set to begin of
+ * period on skipped time ticks (also over several hyperperiods)
+ */
+void test_TKLsdlrRelTbl_checkLastRunIsAlwaysSetToBeginOfPeriodOnTickLoss(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* .active, .period, .deadline, .lastRun, .p_tskRunner */
+        {true, 30u, 30u, TKLTYP_CALC_OFFSET(30u, 10u), &TKLtsk_runner0},
+        {false, 40u, 40u, TKLTYP_CALC_OFFSET(40u, 30u), &TKLtsk_runner1},
+        {true, 90u, 90u, 0u, &TKLtsk_runner2}
+    };
+
+    /* Run task runner 0, 2 */
+    TKLtick_getTick_ExpectAndReturn(3627u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(3627u);
+    TKLtick_getTick_ExpectAndReturn(3627u);
+    TKLtsk_runner2_Expect();
+    TKLtick_getTick_ExpectAndReturn(3627u);
+
+    /* Run no task runner */
+    TKLtick_getTick_ExpectAndReturn(3628u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 3u);
+    TKLsdlr_setRelTbl(&pv_relTbl);
+    for (uint8_t i = 0u; i < 3; i++) {
+        TKLsdlr_execTbl();
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(3610u, tskLst[0].lastRun);
+    TEST_ASSERT_EQUAL_UINT32(3590u, tskLst[1].lastRun);
+    TEST_ASSERT_EQUAL_UINT32(3600u, tskLst[2].lastRun);
+}
+
+/**
+ * \brief Test if task deadline overrun is detected on release table driven
+ * scheduler cycle
+ */
+void test_TKLsdlrRelTbl_detectAndCntSingleTskOverrun(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* .active, .period, .deadline, .lastRun, .p_tskRunner */
+        {true, 30u, 5u, TKLTYP_CALC_OFFSET(30u, 10u), &TKLtsk_runner0},
+        {false, 40u, 40u, TKLTYP_CALC_OFFSET(40u, 30u), &TKLtsk_runner1},
+        {false, 90u, 90u, 0u, &TKLtsk_runner2}
+    };
+
+    TKLtick_getTick_ExpectAndReturn(12u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(16u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 3u);
+    TKLsdlr_setRelTbl(&pv_relTbl);
+    TKLsdlr_execTbl();
+
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLsdlr_cntTskOverrun());
+}
+
+#endif /* TEST */
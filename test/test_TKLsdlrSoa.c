@@ -0,0 +1,146 @@
+/** \file */
+
+#ifdef TEST
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "assert.h" /* Sanity checks (Design by Contract); replaced for unit
+                       testing */
+
+#include "unity.h"
+
+#include "TKLsdlr.h"
+
+#include "TKLtyp.h"
+#include "mock_TKLtick.h"
+
+#include "mock_TKLtsk.h"
+
+/* "Invisible" API for unit tests to modify internal state (private vars.) */
+extern void TKLsdlr_utModTickSrcTskLst(const TKLtyp_p_getTick_t p_getTick,
+                                       TKLsdlr_tskLst_t* const p_tskLst,
+                                       const uint8_t tskCnt);
+
+
+/* ATTRIBUTES
+ * ==========
+ */
+
+/**
+ * \brief Task list (X macro, see \ref TKLSDLR_TSK_LST_DEF())
+ */
+#define TSK_LST(X_) \
+    X_(true, 2u, 1u, 0u, &TKLtsk_runner0) \
+    X_(true, 3u, 1u, 0u, &TKLtsk_runner1) \
+    X_(false, 4u, 2u, TKLTYP_CALC_OFFSET(4u, 1u), &TKLtsk_runner2)
+
+/* OPERATIONS
+ * ==========
+ */
+
+/** \brief Run before every test */
+void setUp(void) {
+    /* Do nothing */
+}
+
+/** \brief Run after every test */
+void tearDown(void) {
+    /* Reset internal state (private vars.) */
+    TKLsdlr_utModTickSrcTskLst(NULL, NULL, 0u);
+    TKLsdlr_clrTskOverrun();
+}
+
+/**
+ * \brief Test that a task list defined via migration macros is split into
+ * hot, activation status and cold arrays and registered as such
+ */
+void test_TKLsdlrSoa_defAndSetTskLst(void) {
+    TKLSDLR_TSK_LST_DEF(, tskLst, TSK_LST);
+
+    TEST_ASSERT_EQUAL_UINT8(3u, TKLSDLR_TSK_LST_CNT(tskLst));
+    TEST_ASSERT_EQUAL_UINT32(3u, tskLstHot[1].period);
+    TEST_ASSERT_EQUAL_UINT32(UINT32_MAX - 2u, tskLstHot[2].lastRun);
+    TEST_ASSERT_FALSE(tskLstActive[2]);
+    TEST_ASSERT_EQUAL_UINT32(2u, tskLstCold[2].deadline);
+    TEST_ASSERT_EQUAL_PTR(&TKLtsk_runner2, tskLstCold[2].p_tskRunner);
+
+    TKLsdlr_setTskLst(TKLSDLR_TSK_LST(tskLst), TKLSDLR_TSK_LST_CNT(tskLst));
+
+    TEST_ASSERT_EQUAL_PTR(&tskLst, TKLsdlr_getTskLst());
+    TEST_ASSERT_EQUAL_UINT8(3u, TKLsdlr_cntTsk());
+    TEST_ASSERT_EQUAL_UINT32(2u, TKLSDLR_TSK_PERIOD(TKLsdlr_getTskLst(), 0u));
+}
+
+/**
+ * \brief Test that assert fires on attempt to register a task list with
+ * invalid hot or cold data
+ */
+void test_TKLsdlrSoa_assertInvalidTskOnSetTskLst(void) {
+#define TSK_LST_NO_PERIOD(X_) X_(true, 0u, 1u, 0u, &TKLtsk_runner)
+#define TSK_LST_NO_DEADLINE(X_) X_(true, 1u, 0u, 0u, &TKLtsk_runner)
+#define TSK_LST_NO_RUNNER(X_) X_(true, 1u, 1u, 0u, NULL)
+    TKLSDLR_TSK_LST_DEF(, tskLstNoPeriod, TSK_LST_NO_PERIOD);
+    TKLSDLR_TSK_LST_DEF(, tskLstNoDeadline, TSK_LST_NO_DEADLINE);
+    TKLSDLR_TSK_LST_DEF(, tskLstNoRunner, TSK_LST_NO_RUNNER);
+
+    TEST_ASSERT_FAIL_ASSERT(
+        TKLsdlr_setTskLst(TKLSDLR_TSK_LST(tskLstNoPeriod), 1u));
+    TEST_ASSERT_FAIL_ASSERT(
+        TKLsdlr_setTskLst(TKLSDLR_TSK_LST(tskLstNoDeadline), 1u));
+    TEST_ASSERT_FAIL_ASSERT(
+        TKLsdlr_setTskLst(TKLSDLR_TSK_LST(tskLstNoRunner), 1u));
+#undef TSK_LST_NO_PERIOD
+#undef TSK_LST_NO_DEADLINE
+#undef TSK_LST_NO_RUNNER
+}
+
+/**
+ * \brief Test that due tasks are run in order of priority, with `lastRun`
+ * time and deadline overrun detection based on the hot and cold arrays
+ */
+void test_TKLsdlrSoa_execDueToRunTskAndDetectTskOverrun(void) {
+    TKLSDLR_TSK_LST_DEF(, tskLst, TSK_LST);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(TKLSDLR_TSK_LST(tskLst), TKLSDLR_TSK_LST_CNT(tskLst));
+
+    TKLtick_getTick_ExpectAndReturn(3u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(3u);
+    TKLsdlr_exec();
+
+    TKLtick_getTick_ExpectAndReturn(3u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(5u); /* Overrun (deadline at `4`) */
+    TKLsdlr_exec();
+
+    TEST_ASSERT_EQUAL_UINT32(2u, TKLSDLR_TSK_LAST_RUN(&tskLst, 0u));
+    TEST_ASSERT_EQUAL_UINT32(3u, TKLSDLR_TSK_LAST_RUN(&tskLst, 1u));
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLsdlr_cntTskOverrun());
+}
+
+/**
+ * \brief Test that a task is enabled/disabled via the activation status array
+ * and its `lastRun` time within the hot array is updated
+ */
+void test_TKLsdlrSoa_enaAndDisTsk(void) {
+    TKLSDLR_TSK_LST_DEF(, tskLst, TSK_LST);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(TKLSDLR_TSK_LST(tskLst), TKLSDLR_TSK_LST_CNT(tskLst));
+
+    TKLtick_getTick_ExpectAndReturn(7u);
+    TKLsdlr_setTskAct(&TKLtsk_runner2, true, true);
+
+    TEST_ASSERT_TRUE(TKLSDLR_TSK_ACTIVE(&tskLst, 2u));
+    TEST_ASSERT_EQUAL_UINT32(7u, TKLSDLR_TSK_LAST_RUN(&tskLst, 2u));
+
+    TKLsdlr_setTskActIdx(0u, false, false);
+
+    TEST_ASSERT_FALSE(tskLstActive[0]);
+    TEST_ASSERT_TRUE(tskLstActive[1]);
+    TEST_ASSERT_EQUAL_UINT32(0u, tskLstHot[0].lastRun);
+}
+
+#endif /* TEST */
@@ -0,0 +1,179 @@
+/** \file */
+
+#ifdef TEST
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "assert.h" /* Sanity checks (Design by Contract); replaced for unit
+                       testing */
+
+#include "unity.h"
+
+#include "TKLsdlr.h"
+
+#include "TKLtyp.h"
+#include "mock_TKLtick.h"
+
+#include "mock_TKLtsk.h"
+
+/* "Invisible" API for unit tests to modify internal state (private vars.) */
+extern void TKLsdlr_utModTickSrcTskLst(const TKLtyp_p_getTick_t p_getTick,
+                                       TKLtyp_tsk_t* const p_tskLst,
+                                       const uint8_t tskCnt);
+
+/* OPERATIONS
+ * ==========
+ */
+
+/** \brief Run before every test */
+void setUp(void) {
+    /* Do nothing */
+}
+
+/** \brief Run after every test */
+void tearDown(void) {
+    /* Reset internal state (private vars.) */
+    TKLsdlr_utModTickSrcTskLst(NULL, NULL, 0u);
+    TKLsdlr_clrTskOverrun();
+}
+
+/** \brief Test that execution statistics are enabled for this test file */
+void test_TKLsdlrStat_checkStatIsEna(void) {
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLSDLRCFG_STAT_ENA);
+}
+
+/**
+ * \brief Test that assert fires on attempt to get execution statistics of a
+ * task that is not within task list or without destination
+ */
+void test_TKLsdlrStat_assertInvalidArgOnGetTskStat(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 1u,
+         .deadline = 1u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner}
+    };
+    TKLtyp_tskStat_t tskStat;
+
+    TKLsdlr_utModTickSrcTskLst(&TKLtick_getTick, tskLst, 1u);
+    TEST_ASSERT_PASS_ASSERT(TKLsdlr_getTskStat(0u, &tskStat));
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_getTskStat(1u, &tskStat));
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_getTskStat(0u, NULL));
+}
+
+/**
+ * \brief Test that execution time, response time and release jitter are
+ * recorded for each task run
+ */
+void test_TKLsdlrStat_recTskRun(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* Released at `10`, `20`, `30` */
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0},
+        /* Never released */
+        {.active = true,
+         .period = 100u,
+         .deadline = 100u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner1}
+    };
+    TKLtyp_tskStat_t tskStat;
+
+    /* Run task runner 0: execution time 2, response time 2, start delay 0 */
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(12u);
+
+    /* Run task runner 0: execution time 1, response time 4, start delay 3 */
+    TKLtick_getTick_ExpectAndReturn(23u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(24u);
+
+    /* Run task runner 0: execution time 6, response time 6, start delay 0 */
+    TKLtick_getTick_ExpectAndReturn(30u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(36u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 2u);
+    for (uint8_t i = 0u; i < 3; i++) {
+        TKLsdlr_exec();
+    }
+
+    TKLsdlr_getTskStat(0u, &tskStat);
+    TEST_ASSERT_EQUAL_UINT32(3u, tskStat.runCnt);
+    TEST_ASSERT_EQUAL_UINT32(1u, tskStat.execMin);
+    TEST_ASSERT_EQUAL_UINT32(6u, tskStat.execMax);
+    TEST_ASSERT_EQUAL_UINT32(3u, tskStat.execMean);
+    TEST_ASSERT_EQUAL_UINT32(2u, tskStat.respMin);
+    TEST_ASSERT_EQUAL_UINT32(6u, tskStat.respMax);
+    TEST_ASSERT_EQUAL_UINT32(4u, tskStat.respMean);
+    TEST_ASSERT_EQUAL_UINT32(3u, tskStat.relJitter);
+
+    /* Task never run */
+    TKLsdlr_getTskStat(1u, &tskStat);
+    TEST_ASSERT_EQUAL_UINT32(0u, tskStat.runCnt);
+    TEST_ASSERT_EQUAL_UINT32(0u, tskStat.execMin);
+    TEST_ASSERT_EQUAL_UINT32(0u, tskStat.execMax);
+    TEST_ASSERT_EQUAL_UINT32(0u, tskStat.respMax);
+    TEST_ASSERT_EQUAL_UINT32(0u, tskStat.relJitter);
+}
+
+/**
+ * \brief Test that execution statistics are not recorded for disabled tasks
+ * and are reset on demand and on task list registration
+ */
+void test_TKLsdlrStat_clrStat(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* Disabled, released at `5` */
+        {.active = false,
+         .period = 5u,
+         .deadline = 5u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0},
+        /* Released at `5` */
+        {.active = true,
+         .period = 5u,
+         .deadline = 5u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner1}
+    };
+    TKLtyp_tskStat_t tskStat;
+
+    /* Run task runner 1 (twice) */
+    TKLtick_getTick_ExpectAndReturn(5u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(6u);
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(11u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 2u);
+    TKLsdlr_exec();
+
+    TKLsdlr_getTskStat(0u, &tskStat);
+    TEST_ASSERT_EQUAL_UINT32(0u, tskStat.runCnt);
+    TKLsdlr_getTskStat(1u, &tskStat);
+    TEST_ASSERT_EQUAL_UINT32(1u, tskStat.runCnt);
+
+    TKLsdlr_clrTskStat();
+    TKLsdlr_getTskStat(1u, &tskStat);
+    TEST_ASSERT_EQUAL_UINT32(0u, tskStat.runCnt);
+
+    TKLsdlr_exec();
+    TKLsdlr_getTskStat(1u, &tskStat);
+    TEST_ASSERT_EQUAL_UINT32(1u, tskStat.runCnt);
+    TEST_ASSERT_EQUAL_UINT32(1u, tskStat.execMin);
+
+    TKLsdlr_setTskLst(tskLst, 2u);
+    TKLsdlr_getTskStat(1u, &tskStat);
+    TEST_ASSERT_EQUAL_UINT32(0u, tskStat.runCnt);
+}
+
+#endif /* TEST */
@@ -0,0 +1,164 @@
+/** \file */
+
+#ifdef TEST
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "assert.h" /* Sanity checks (Design by Contract); replaced for unit
+                       testing */
+
+#include "unity.h"
+
+#include "TKLsdlr.h"
+
+#include "TKLtyp.h"
+#include "mock_TKLtick.h"
+
+#include "mock_TKLtsk.h"
+
+#include "TKLsdlrUtTickRollover.h" /* Shared time tick rollover test bodies */
+
+/* "Invisible" API for unit tests to modify internal state (private vars.) */
+extern void TKLsdlr_utModTickSrcTskLst(const TKLtyp_p_getTick_t p_getTick,
+                                       TKLtyp_tsk_t* const p_tskLst,
+                                       const uint8_t tskCnt);
+
+/* OPERATIONS
+ * ==========
+ */
+
+/** \brief Run before every test */
+void setUp(void) {
+    /* Do nothing */
+}
+
+/** \brief Run after every test */
+void tearDown(void) {
+    /* Reset internal state (private vars.) */
+    TKLsdlr_utModTickSrcTskLst(NULL, NULL, 0u);
+    TKLsdlr_clrTskOverrun();
+}
+
+/**
+ * \brief Test that time tick type is 16 bit wide and that offset helper wraps
+ * within that width
+ */
+void test_TKLsdlrTick16_tickTypWidth(void) {
+    TEST_ASSERT_EQUAL_UINT8(2u, sizeof(TKLtyp_tick_t));
+    TEST_ASSERT_EQUAL_UINT16(0xFFFFu, TKLTYP_TICK_MAX);
+    TEST_ASSERT_EQUAL_UINT16(0xFFF6u, TKLTYP_CALC_OFFSET(10u, 0u));
+}
+
+/**
+ * \brief Test correct execution of due-to-run task at 3 time ticks period with
+ * 16 bit relative system time tick count rollover
+ */
+void test_TKLsdlrTick16_execDueToRunTskOnTickRollover(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 3u,
+         .deadline = 3u,
+         .lastRun = 0xFFFAu,
+         .p_tskRunner = &TKLtsk_runner}
+    };
+
+    /* Run */
+    TKLtick_getTick_ExpectAndReturn(0xFFFDu);
+    TKLtsk_runner_Expect();
+    TKLtick_getTick_ExpectAndReturn(0xFFFDu);
+
+    /* No run */
+    TKLtick_getTick_ExpectAndReturn(0xFFFFu);
+
+    /* Run */
+    TKLtick_getTick_ExpectAndReturn(0x0000u);
+    TKLtsk_runner_Expect();
+    TKLtick_getTick_ExpectAndReturn(0x0000u);
+
+    /* No run */
+    TKLtick_getTick_ExpectAndReturn(0x0002u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 1u);
+    for (uint8_t i = 0u; i < 4; i++) {
+        TKLsdlr_exec();
+    }
+
+    TEST_ASSERT_EQUAL_UINT16(0x0000u, tskLst[0].lastRun);
+}
+
+/**
+ * \brief Test that task deadline overruns are detected correctly on 16 bit
+ * relative system time tick count rollover
+ */
+void test_TKLsdlrTick16_detectTskOverrunOnTickRollover(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* Released at `0xFFFA` and `0x005E` */
+        {.active = true,
+         .period = 100u,
+         .deadline = 10u,
+         .lastRun = 0xFF96u,
+         .p_tskRunner = &TKLtsk_runner}
+    };
+
+    /* No task overrun (finished at rollover) */
+    TKLtick_getTick_ExpectAndReturn(0xFFFAu);
+    TKLtsk_runner_Expect();
+    TKLtick_getTick_ExpectAndReturn(0x0003u);
+
+    /* Task overrun */
+    TKLtick_getTick_ExpectAndReturn(0x005Eu);
+    TKLtsk_runner_Expect();
+    TKLtick_getTick_ExpectAndReturn(0x0069u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 1u);
+    TKLsdlr_exec();
+    TEST_ASSERT_EQUAL_UINT8(0u, TKLsdlr_cntTskOverrun());
+    TKLsdlr_exec();
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLsdlr_cntTskOverrun());
+}
+
+/**
+ * \brief Test that number of time ticks to next task release is 16 bit max.
+ * value if no task is enabled, and still correct on time tick count rollover
+ */
+void test_TKLsdlrTick16_cntTickToNextRel(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* Released at `0x0006` */
+        {.active = false,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0xFFFCu,
+         .p_tskRunner = &TKLtsk_runner}
+    };
+
+    TKLtick_getTick_ExpectAndReturn(0xFFFEu);
+    TKLtick_getTick_ExpectAndReturn(0xFFFEu);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 1u);
+    TEST_ASSERT_EQUAL_UINT16(0xFFFFu, TKLsdlr_cntTickToNextRel());
+
+    tskLst[0].active = true;
+
+    TEST_ASSERT_EQUAL_UINT16(8u, TKLsdlr_cntTickToNextRel());
+}
+
+/** \brief See \ref pv_detectAndCntMultiTskOverrunOnTickRollover() */
+void test_TKLsdlrTick16_detectAndCntMultiTskOverrunOnTickRollover(void) {
+    pv_detectAndCntMultiTskOverrunOnTickRollover();
+}
+
+/** \brief See \ref pv_detectAndCntSingleTskOverrunOnInconvTickRollover() */
+void test_TKLsdlrTick16_detectAndCntSingleTskOverrunOnInconvTickRollover(void) {
+    pv_detectAndCntSingleTskOverrunOnInconvTickRollover();
+}
+
+/** \brief See \ref pv_execDueToRunTskAt3TickPeriodOnTickRollover() */
+void test_TKLsdlrTick16_execDueToRunTskAt3TickPeriodOnTickRollover(void) {
+    pv_execDueToRunTskAt3TickPeriodOnTickRollover();
+}
+
+#endif /* TEST */
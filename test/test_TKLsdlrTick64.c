@@ -0,0 +1,157 @@
+/** \file */
+
+#ifdef TEST
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "assert.h" /* Sanity checks (Design by Contract); replaced for unit
+                       testing */
+
+#include "unity.h"
+
+#include "TKLsdlr.h"
+
+#include "TKLtyp.h"
+#include "mock_TKLtick.h"
+
+#include "mock_TKLtsk.h"
+
+#include "TKLsdlrUtTickRollover.h" /* Shared time tick rollover test bodies */
+
+/* "Invisible" API for unit tests to modify internal state (private vars.) */
+extern void TKLsdlr_utModTickSrcTskLst(const TKLtyp_p_getTick_t p_getTick,
+                                       TKLtyp_tsk_t* const p_tskLst,
+                                       const uint8_t tskCnt);
+
+/* OPERATIONS
+ * ==========
+ */
+
+/** \brief Run before every test */
+void setUp(void) {
+    /* Do nothing */
+}
+
+/** \brief Run after every test */
+void tearDown(void) {
+    /* Reset internal state (private vars.) */
+    TKLsdlr_utModTickSrcTskLst(NULL, NULL, 0u);
+    TKLsdlr_clrTskOverrun();
+}
+
+/**
+ * \brief Test that time tick type is 64 bit wide and that offset helper wraps
+ * within that width
+ */
+void test_TKLsdlrTick64_tickTypWidth(void) {
+    TEST_ASSERT_EQUAL_UINT8(8u, sizeof(TKLtyp_tick_t));
+    TEST_ASSERT_EQUAL_UINT64(0xFFFFFFFFFFFFFFFFu, TKLTYP_TICK_MAX);
+    TEST_ASSERT_EQUAL_UINT64(0xFFFFFFFFFFFFFFF6u, TKLTYP_CALC_OFFSET(10u, 0u));
+}
+
+/**
+ * \brief Test correct execution of due-to-run task with period beyond 32 bit
+ * range on 64 bit relative system time tick count rollover
+ */
+void test_TKLsdlrTick64_execDueToRunTskOnTickRollover(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* Released at `0x0000000080000000` */
+        {.active = true,
+         .period = 0x180000000u,
+         .deadline = 0x180000000u,
+         .lastRun = 0xFFFFFFFF00000000u,
+         .p_tskRunner = &TKLtsk_runner}
+    };
+
+    /* No run */
+    TKLtick_getTick_ExpectAndReturn(0xFFFFFFFFFFFFFFFFu);
+    TKLtick_getTick_ExpectAndReturn(0x000000007FFFFFFFu);
+
+    /* Run */
+    TKLtick_getTick_ExpectAndReturn(0x0000000080000005u);
+    TKLtsk_runner_Expect();
+    TKLtick_getTick_ExpectAndReturn(0x0000000080000005u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 1u);
+    for (uint8_t i = 0u; i < 3; i++) {
+        TKLsdlr_exec();
+    }
+
+    TEST_ASSERT_EQUAL_UINT64(0x0000000080000000u, tskLst[0].lastRun);
+}
+
+/**
+ * \brief Test that task deadline overruns are detected correctly with
+ * response times beyond 32 bit range
+ */
+void test_TKLsdlrTick64_detectTskOverrunBeyond32Bit(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 0x200000000u,
+         .deadline = 0x100000000u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner}
+    };
+
+    /* No task overrun */
+    TKLtick_getTick_ExpectAndReturn(0x200000000u);
+    TKLtsk_runner_Expect();
+    TKLtick_getTick_ExpectAndReturn(0x300000000u);
+
+    /* Task overrun */
+    TKLtick_getTick_ExpectAndReturn(0x400000000u);
+    TKLtsk_runner_Expect();
+    TKLtick_getTick_ExpectAndReturn(0x500000001u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 1u);
+    TKLsdlr_exec();
+    TEST_ASSERT_EQUAL_UINT8(0u, TKLsdlr_cntTskOverrun());
+    TKLsdlr_exec();
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLsdlr_cntTskOverrun());
+}
+
+/**
+ * \brief Test that number of time ticks to next task release is 64 bit max.
+ * value if no task is enabled, and still correct beyond 32 bit range
+ */
+void test_TKLsdlrTick64_cntTickToNextRel(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* Released at `0x200000000` */
+        {.active = false,
+         .period = 0x200000000u,
+         .deadline = 0x200000000u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner}
+    };
+
+    TKLtick_getTick_ExpectAndReturn(1u);
+    TKLtick_getTick_ExpectAndReturn(1u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 1u);
+    TEST_ASSERT_EQUAL_UINT64(0xFFFFFFFFFFFFFFFFu, TKLsdlr_cntTickToNextRel());
+
+    tskLst[0].active = true;
+
+    TEST_ASSERT_EQUAL_UINT64(0x1FFFFFFFFu, TKLsdlr_cntTickToNextRel());
+}
+
+/** \brief See \ref pv_detectAndCntMultiTskOverrunOnTickRollover() */
+void test_TKLsdlrTick64_detectAndCntMultiTskOverrunOnTickRollover(void) {
+    pv_detectAndCntMultiTskOverrunOnTickRollover();
+}
+
+/** \brief See \ref pv_detectAndCntSingleTskOverrunOnInconvTickRollover() */
+void test_TKLsdlrTick64_detectAndCntSingleTskOverrunOnInconvTickRollover(void) {
+    pv_detectAndCntSingleTskOverrunOnInconvTickRollover();
+}
+
+/** \brief See \ref pv_execDueToRunTskAt3TickPeriodOnTickRollover() */
+void test_TKLsdlrTick64_execDueToRunTskAt3TickPeriodOnTickRollover(void) {
+    pv_execDueToRunTskAt3TickPeriodOnTickRollover();
+}
+
+#endif /* TEST */
@@ -0,0 +1,211 @@
+/** \file */
+
+#ifdef TEST
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "assert.h" /* Sanity checks (Design by Contract); replaced for unit
+                       testing */
+
+#include "unity.h"
+
+#include "TKLsdlr.h"
+
+#include "TKLtyp.h"
+#include "mock_TKLtick.h"
+
+#include "mock_TKLtsk.h"
+
+/* "Invisible" API for unit tests to modify internal state (private vars.) */
+extern void TKLsdlr_utModTickSrcTskLst(const TKLtyp_p_getTick_t p_getTick,
+                                       TKLtyp_tsk_t* const p_tskLst,
+                                       const uint8_t tskCnt);
+
+/* OPERATIONS
+ * ==========
+ */
+
+/** \brief Run before every test */
+void setUp(void) {
+    /* Do nothing */
+}
+
+/** \brief Run after every test */
+void tearDown(void) {
+    /* Reset internal state (private vars.) */
+    TKLsdlr_utModTickSrcTskLst(NULL, NULL, 0u);
+    TKLsdlr_clrTskOverrun();
+
+    /* Empty trace ring buffer */
+    TKLtyp_traceEvt_t traceEvt;
+    while (true == TKLsdlr_getTraceEvt(&traceEvt)) {
+        /* Do nothing (discard event) */
+    }
+}
+
+/**
+ * \brief Assert next trace event from trace ring buffer
+ *
+ * \param typ Expected event type
+ * \param tskIdx Expected task index
+ * \param tick Expected time stamp
+ */
+static void assertTraceEvt(const uint8_t typ,
+                           const uint8_t tskIdx,
+                           const uint32_t tick) {
+    TKLtyp_traceEvt_t traceEvt;
+
+    TEST_ASSERT_TRUE(TKLsdlr_getTraceEvt(&traceEvt));
+    TEST_ASSERT_EQUAL_UINT8(typ, traceEvt.typ);
+    TEST_ASSERT_EQUAL_UINT8(tskIdx, traceEvt.tskIdx);
+    TEST_ASSERT_EQUAL_UINT32(tick, traceEvt.tick);
+}
+
+/** \brief Test that trace is enabled for this test file (with 4 events) */
+void test_TKLsdlrTrace_checkTraceIsEna(void) {
+    TEST_ASSERT_EQUAL_UINT8(1u, TKLSDLRCFG_TRACE_ENA);
+    TEST_ASSERT_EQUAL_UINT8(4u, TKLSDLRCFG_TRACE_BUF_LEN);
+}
+
+/**
+ * \brief Test that assert fires on attempt to fetch trace event without
+ * destination
+ */
+void test_TKLsdlrTrace_assertNoDestOnGetTraceEvt(void) {
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_getTraceEvt(NULL));
+}
+
+/** \brief Test that trace ring buffer is initially empty */
+void test_TKLsdlrTrace_checkTraceIsEmpty(void) {
+    TKLtyp_traceEvt_t traceEvt;
+
+    TEST_ASSERT_FALSE(TKLsdlr_getTraceEvt(&traceEvt));
+}
+
+/**
+ * \brief Test that release, start, end and overrun events of task runs are
+ * recorded in order
+ */
+void test_TKLsdlrTrace_recTskRunEvt(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        /* Released at `10` */
+        {.active = true,
+         .period = 10u,
+         .deadline = 5u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0},
+        /* Released at `10` */
+        {.active = true,
+         .period = 10u,
+         .deadline = 5u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner1}
+    };
+    TKLtyp_traceEvt_t traceEvt;
+
+    /* Run task runner 0 in time */
+    TKLtick_getTick_ExpectAndReturn(11u);
+    TKLtsk_runner0_Expect();
+    TKLtick_getTick_ExpectAndReturn(12u);
+
+    /* Run task runner 1, which overruns */
+    TKLtick_getTick_ExpectAndReturn(12u);
+    TKLtsk_runner1_Expect();
+    TKLtick_getTick_ExpectAndReturn(16u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 2u);
+
+    TKLsdlr_exec();
+    assertTraceEvt(TKLTYP_TRACE_REL, 0u, 10u);
+    assertTraceEvt(TKLTYP_TRACE_START, 0u, 11u);
+    assertTraceEvt(TKLTYP_TRACE_END, 0u, 12u);
+    TEST_ASSERT_FALSE(TKLsdlr_getTraceEvt(&traceEvt));
+
+    TKLsdlr_exec();
+    assertTraceEvt(TKLTYP_TRACE_REL, 1u, 10u);
+    assertTraceEvt(TKLTYP_TRACE_START, 1u, 12u);
+    assertTraceEvt(TKLTYP_TRACE_END, 1u, 16u);
+    assertTraceEvt(TKLTYP_TRACE_OVERRUN, 1u, 16u);
+    TEST_ASSERT_FALSE(TKLsdlr_getTraceEvt(&traceEvt));
+}
+
+/**
+ * \brief Test that enable and disable events are recorded (only) on change of
+ * task activation status
+ */
+void test_TKLsdlrTrace_recTskActEvt(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner0},
+        {.active = false,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner1}
+    };
+    TKLtyp_traceEvt_t traceEvt;
+
+    TKLtick_getTick_ExpectAndReturn(3u);
+    TKLtick_getTick_ExpectAndReturn(4u);
+    TKLtick_getTick_ExpectAndReturn(5u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 2u);
+
+    TKLsdlr_setTskAct(&TKLtsk_runner0, false, false);
+    TKLsdlr_setTskAct(&TKLtsk_runner1, true, false);
+    TKLsdlr_setTskAct(&TKLtsk_runner1, true, false); /* No change */
+    assertTraceEvt(TKLTYP_TRACE_DIS, 0u, 3u);
+    assertTraceEvt(TKLTYP_TRACE_ENA, 1u, 4u);
+    TEST_ASSERT_FALSE(TKLsdlr_getTraceEvt(&traceEvt));
+}
+
+/**
+ * \brief Test that events are dropped and counted if trace ring buffer is full
+ * (and that buffer wraps around correctly)
+ */
+void test_TKLsdlrTrace_dropEvtIfFull(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 10u,
+         .deadline = 10u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner}
+    };
+    TKLtyp_traceEvt_t traceEvt;
+
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLtsk_runner_Expect();
+    TKLtick_getTick_ExpectAndReturn(11u);
+    TKLtick_getTick_ExpectAndReturn(20u);
+    TKLtsk_runner_Expect();
+    TKLtick_getTick_ExpectAndReturn(21u);
+    TKLtick_getTick_ExpectAndReturn(30u);
+    TKLtsk_runner_Expect();
+    TKLtick_getTick_ExpectAndReturn(31u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTskLst(tskLst, 1u);
+
+    TKLsdlr_exec(); /* 3 events */
+    TKLsdlr_exec(); /* 1 more event, 2 dropped */
+    TEST_ASSERT_EQUAL_UINT8(2u, TKLsdlr_cntTraceDrop());
+    assertTraceEvt(TKLTYP_TRACE_REL, 0u, 10u);
+    assertTraceEvt(TKLTYP_TRACE_START, 0u, 10u);
+    assertTraceEvt(TKLTYP_TRACE_END, 0u, 11u);
+    assertTraceEvt(TKLTYP_TRACE_REL, 0u, 20u);
+
+    TKLsdlr_exec(); /* 3 events (wrap around) */
+    TEST_ASSERT_EQUAL_UINT8(2u, TKLsdlr_cntTraceDrop());
+    assertTraceEvt(TKLTYP_TRACE_REL, 0u, 30u);
+    assertTraceEvt(TKLTYP_TRACE_START, 0u, 30u);
+    assertTraceEvt(TKLTYP_TRACE_END, 0u, 31u);
+    TEST_ASSERT_FALSE(TKLsdlr_getTraceEvt(&traceEvt));
+}
+
+#endif /* TEST */
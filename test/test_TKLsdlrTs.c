@@ -0,0 +1,162 @@
+/** \file */
+
+#ifdef TEST
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "assert.h" /* Sanity checks (Design by Contract); replaced for unit
+                       testing */
+
+#include "unity.h"
+
+#include "TKLsdlr.h"
+
+#include "TKLtyp.h"
+#include "mock_TKLtick.h"
+
+#include "mock_TKLtsk.h"
+
+/* "Invisible" API for unit tests to modify internal state (private vars.) */
+extern void TKLsdlr_utModTickSrcTskLst(const TKLtyp_p_getTick_t p_getTick,
+                                       TKLtyp_tsk_t* const p_tskLst,
+                                       const uint8_t tskCnt);
+
+/* OPERATIONS
+ * ==========
+ */
+
+/** \brief Run before every test */
+void setUp(void) {
+    /* Do nothing */
+}
+
+/** \brief Run after every test */
+void tearDown(void) {
+    /* Reset internal state (private vars.) */
+    TKLsdlr_utModTickSrcTskLst(NULL, NULL, 0u);
+    TKLsdlr_clrTskOverrun();
+}
+
+/** \brief Test that assert fires on attempt to register no time stamp source */
+void test_TKLsdlrTs_assertInvalidArgOnSetTsSrc(void) {
+    TEST_ASSERT_FAIL_ASSERT(TKLsdlr_setTsSrc(NULL));
+    TEST_ASSERT_PASS_ASSERT(TKLsdlr_setTsSrc(&TKLtick_getTs));
+}
+
+/**
+ * \brief Test that execution times in time stamp units are recorded with
+ * sub-tick resolution, also on time stamp rollover
+ */
+void test_TKLsdlrTs_getTskStatExecTs(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 1u,
+         .deadline = 1u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner}
+    };
+    TKLtyp_tskStat_t tskStat;
+
+    /* Within one time tick */
+    TKLtick_getTick_ExpectAndReturn(1u);
+    TKLtick_getTs_ExpectAndReturn(1000u);
+    TKLtsk_runner_Expect();
+    TKLtick_getTs_ExpectAndReturn(1120u);
+    TKLtick_getTick_ExpectAndReturn(1u);
+
+    /* On time stamp rollover */
+    TKLtick_getTick_ExpectAndReturn(2u);
+    TKLtick_getTs_ExpectAndReturn(UINT32_MAX - 9u);
+    TKLtsk_runner_Expect();
+    TKLtick_getTs_ExpectAndReturn(30u);
+    TKLtick_getTick_ExpectAndReturn(2u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTsSrc(&TKLtick_getTs);
+    TKLsdlr_setTskLst(tskLst, 1u);
+    TKLsdlr_exec();
+    TKLsdlr_exec();
+    TKLsdlr_getTskStat(0u, &tskStat);
+
+    TEST_ASSERT_EQUAL_UINT32(2u, tskStat.runCnt);
+    TEST_ASSERT_EQUAL_UINT32(0u, tskStat.execMax);
+    TEST_ASSERT_EQUAL_UINT32(40u, tskStat.execTsMin);
+    TEST_ASSERT_EQUAL_UINT32(120u, tskStat.execTsMax);
+    TEST_ASSERT_EQUAL_UINT32(80u, tskStat.execTsMean);
+
+    TKLsdlr_clrTskStat();
+    TKLsdlr_getTskStat(0u, &tskStat);
+
+    TEST_ASSERT_EQUAL_UINT32(0u, tskStat.execTsMin);
+    TEST_ASSERT_EQUAL_UINT32(0u, tskStat.execTsMax);
+}
+
+/**
+ * \brief Test that execution time in time stamp units of most recent deadline
+ * overrun is recorded
+ */
+void test_TKLsdlrTs_getTskOverrunLastExecTs(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 10u,
+         .deadline = 2u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner}
+    };
+    TKLtyp_tskOverrun_t tskOverrun;
+
+    /* Task overrun */
+    TKLtick_getTick_ExpectAndReturn(10u);
+    TKLtick_getTs_ExpectAndReturn(2500u);
+    TKLtsk_runner_Expect();
+    TKLtick_getTs_ExpectAndReturn(3250u);
+    TKLtick_getTick_ExpectAndReturn(13u);
+
+    /* No task overrun */
+    TKLtick_getTick_ExpectAndReturn(20u);
+    TKLtick_getTs_ExpectAndReturn(5000u);
+    TKLtsk_runner_Expect();
+    TKLtick_getTs_ExpectAndReturn(5010u);
+    TKLtick_getTick_ExpectAndReturn(20u);
+
+    TKLsdlr_setTickSrc(&TKLtick_getTick);
+    TKLsdlr_setTsSrc(&TKLtick_getTs);
+    TKLsdlr_setTskLst(tskLst, 1u);
+    TKLsdlr_exec();
+    TKLsdlr_exec();
+    TKLsdlr_getTskOverrun(0u, &tskOverrun);
+
+    TEST_ASSERT_EQUAL_UINT32(1u, tskOverrun.cnt);
+    TEST_ASSERT_EQUAL_UINT32(750u, tskOverrun.lastExecTs);
+}
+
+/**
+ * \brief Test that no time stamp is queried and execution times in time stamp
+ * units remain `0` if no time stamp source is registered
+ */
+void test_TKLsdlrTs_execWithoutTsSrc(void) {
+    TKLtyp_tsk_t tskLst[] = {
+        {.active = true,
+         .period = 1u,
+         .deadline = 1u,
+         .lastRun = 0u,
+         .p_tskRunner = &TKLtsk_runner}
+    };
+    TKLtyp_tskStat_t tskStat;
+
+    TKLtick_getTick_ExpectAndReturn(1u);
+    TKLtsk_runner_Expect();
+    TKLtick_getTick_ExpectAndReturn(2u);
+
+    TKLsdlr_utModTickSrcTskLst(&TKLtick_getTick, tskLst, 1u);
+    TKLsdlr_exec();
+    TKLsdlr_getTskStat(0u, &tskStat);
+
+    TEST_ASSERT_EQUAL_UINT32(1u, tskStat.runCnt);
+    TEST_ASSERT_EQUAL_UINT32(1u, tskStat.execMax);
+    TEST_ASSERT_EQUAL_UINT32(0u, tskStat.execTsMin);
+    TEST_ASSERT_EQUAL_UINT32(0u, tskStat.execTsMax);
+}
+
+#endif /* TEST */
@@ -0,0 +1,21 @@
+/** \file */
+
+#ifndef TKLSDLRCFG_H
+#define TKLSDLRCFG_H
+
+/* Scheduler configuration for benchmarks (see
+   `test/support/TKLsdlrCfg.h` for documentation of all options) */
+
+#define TKLSDLRCFG_OVERRUN_HOOK(tsk_)
+
+#define TKLSDLRCFG_TSK_CNT_MAX 16u
+
+#ifndef TKLSDLRCFG_REL_RECIP_ENA
+#define TKLSDLRCFG_REL_RECIP_ENA 0
+#endif /* TKLSDLRCFG_REL_RECIP_ENA */
+
+#ifndef TKLSDLRCFG_TSK_SOA_ENA
+#define TKLSDLRCFG_TSK_SOA_ENA 0
+#endif /* TKLSDLRCFG_TSK_SOA_ENA */
+
+#endif /* TKLSDLRCFG_H */
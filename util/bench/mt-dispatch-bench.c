@@ -0,0 +1,144 @@
+/**
+ * \file
+ *
+ * \brief Throughput benchmark of the multi-threaded executor's dispatch and
+ * completion path over the number of worker threads
+ *
+ * Runs execution cycles in which all tasks of a full task list are due, each
+ * doing a short, fixed amount of work, and waits for all of them to finish.
+ * Prints the number of worker threads and the wall-clock time per task run,
+ * so that building it with different numbers of worker threads shows how
+ * dispatching and finishing task runs scale (i.e., whether worker threads
+ * contend for shared state instead of running tasks).
+ *
+ * Build and run on a POSIX host (from the repository root), once per number
+ * of worker threads:
+ *
+ *     for n in 1 2 4 8; do
+ *         gcc -std=c99 -O2 -D_POSIX_C_SOURCE=200809L -DTKLMT_WRK_CNT=${n}u \
+ *             -Isrc -Isrc/bsp/posix -Iutil/bench \
+ *             util/bench/mt-dispatch-bench.c src/bsp/posix/TKLmt.c \
+ *             src/TKLsdlr.c -pthread -o mt-dispatch-bench && \
+ *             ./mt-dispatch-bench
+ *     done
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "TKLmt.h"
+
+/* ATTRIBUTES
+ * ==========
+ */
+
+/** \brief Number of tasks within task list */
+#define BENCH_TSK_CNT 255u
+
+/** \brief Work per task run (loop iterations) */
+#ifndef BENCH_TSK_WORK
+#define BENCH_TSK_WORK 200u
+#endif /* BENCH_TSK_WORK */
+
+/** \brief Number of execution cycles per round */
+#define BENCH_CYC_CNT 200u
+
+/** \brief Number of rounds (min. is taken) */
+#define BENCH_RUN_CNT 8u
+
+/** \brief Time tick count (advanced by one period per execution cycle) */
+static TKLtyp_tick_t pv_tick;
+
+/** \brief Task list */
+static TKLtyp_tsk_t pv_tskLst[BENCH_TSK_CNT];
+
+/** \brief Sink for task work, so that it is not optimized away */
+static volatile uint32_t pv_sink;
+
+/* OPERATIONS
+ * ==========
+ */
+
+/**
+ * \brief Read monotonic clock
+ *
+ * \return Time in ns
+ */
+static uint64_t pv_getNs(void) {
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec);
+}
+
+/**
+ * \brief Time tick count query (only written by dispatching thread while no
+ * task is busy)
+ *
+ * \return Time tick count
+ */
+static TKLtyp_tick_t pv_getTick(void) {
+    return (__atomic_load_n(&pv_tick, __ATOMIC_RELAXED));
+}
+
+/** \brief Task runner doing a fixed amount of work */
+static void pv_tskRunner(void) {
+    uint32_t acc = 0u;
+
+    for (uint32_t i = 0u; BENCH_TSK_WORK > i; i++) {
+        acc += i * i;
+        __asm__ volatile ("" : "+r" (acc)); /* Keep loop */
+    }
+    pv_sink = acc;
+}
+
+int main(void) {
+    uint64_t nsMin = UINT64_MAX;
+
+    for (uint8_t i = 0u; BENCH_TSK_CNT > i; i++) {
+        const TKLtyp_tsk_t tsk = {.active = true,
+                                  .period = 1u,
+                                  .deadline = 1u,
+                                  .lastRun = 0u,
+                                  .p_tskRunner = &pv_tskRunner};
+
+        (void)memcpy(&pv_tskLst[i], &tsk, sizeof(tsk));
+    }
+
+    TKLmt_init();
+    TKLmt_setTickSrc(&pv_getTick);
+    TKLmt_setTskLst(pv_tskLst, BENCH_TSK_CNT);
+
+    for (uint32_t run = 0u; BENCH_RUN_CNT > run; run++) {
+        const uint64_t nsStart = pv_getNs();
+
+        for (uint32_t cyc = 0u; BENCH_CYC_CNT > cyc; cyc++) {
+            __atomic_store_n(&pv_tick, pv_tick + 1u, __ATOMIC_RELAXED);
+            TKLmt_exec(); /* All tasks due */
+            TKLmt_wait();
+        }
+
+        const uint64_t ns = pv_getNs() - nsStart;
+
+        if (ns < nsMin) {
+            nsMin = ns;
+        }
+    }
+
+    TKLmt_stop();
+
+    printf("Multi-threaded executor, %u worker threads, %u tasks of %u "
+           "work loop iterations each\n",
+           (unsigned int)TKLMT_WRK_CNT,
+           (unsigned int)BENCH_TSK_CNT,
+           (unsigned int)BENCH_TSK_WORK);
+    printf("ns per task run: %.1f\n",
+           (double)nsMin / (double)(BENCH_CYC_CNT * BENCH_TSK_CNT));
+    printf("task deadline overruns: %u\n",
+           (unsigned int)TKLmt_cntTskOverrun());
+
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,259 @@
+/**
+ * \file
+ *
+ * \brief Cycle count benchmark of the release time catch-up of due tasks
+ *
+ * Compares the plain remainder calculation
+ * (`tickCnt - ((tickCnt - lastRun) % period)`) with the scheduler's
+ * (division-free) one for releases without lost periods and with lost
+ * periods (power of 2 period and other period), and verifies that both give
+ * the same results (incl. tick count rollover).
+ *
+ * Build and run on a POSIX host (from the repository root), once without and
+ * once with reciprocals:
+ *
+ *     gcc -std=c99 -O2 -Isrc -Iutil/bench util/bench/rel-calc-bench.c \
+ *         -o rel-calc-bench && ./rel-calc-bench
+ *     gcc -std=c99 -O2 -Isrc -Iutil/bench -DTKLSDLRCFG_REL_RECIP_ENA=1 \
+ *         util/bench/rel-calc-bench.c -o rel-calc-bench && ./rel-calc-bench
+ *
+ * Cycles are read via the time stamp counter on x86 and approximated via
+ * `CLOCK_MONOTONIC` (in ns) elsewhere.  For other targets, define
+ * `BENCH_GET_CYC()` (e.g., as `TCNT1` with Timer1 running at the CPU clock
+ * on the ATmega328P) and `BENCH_CASE_CNT` accordingly.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "TKLsdlr.c" /* Provides scheduler’s private release time
+                        calculation */
+
+/* ATTRIBUTES
+ * ==========
+ */
+
+#ifndef BENCH_GET_CYC
+#if defined(__x86_64__) || defined(__i386__)
+/** \brief Read cycle counter */
+#define BENCH_GET_CYC() __builtin_ia32_rdtsc()
+#else
+#define BENCH_GET_CYC() pv_getNs()
+#endif /* defined(__x86_64__) || defined(__i386__) */
+#endif /* BENCH_GET_CYC */
+
+/** \brief Number of calculations per benchmark case and run */
+#ifndef BENCH_CASE_CNT
+#define BENCH_CASE_CNT 4096u
+#endif /* BENCH_CASE_CNT */
+
+/** \brief Number of runs per benchmark case (min. is taken) */
+#define BENCH_RUN_CNT 32u
+
+/** \brief Number of random calculations for verification */
+#define VERIFY_CNT 1000000u
+
+/** \brief Task runner (never run) */
+static void pv_tskRunner(void) {
+    /* Do nothing */
+}
+
+/** \brief Tasks with power of 2 period and other period */
+static TKLtyp_tsk_t pv_tskLst[] = {
+    {.active = true,
+     .period = 1024u,
+     .deadline = 1u,
+     .lastRun = 0u,
+     .p_tskRunner = &pv_tskRunner},
+    {.active = true,
+     .period = 1000u,
+     .deadline = 1u,
+     .lastRun = 0u,
+     .p_tskRunner = &pv_tskRunner}
+};
+
+/** \brief Scheduler instance holding task list */
+static TKLsdlr_ctx_t pv_benchCtx;
+
+/** \brief Time tick counts to calculate release times for */
+static uint32_t pv_tick[BENCH_CASE_CNT];
+
+/** \brief Sink for results (keeps calculations from being optimized away) */
+static volatile uint32_t pv_sink;
+
+/* OPERATIONS
+ * ==========
+ */
+
+#if !defined(__x86_64__) && !defined(__i386__)
+/**
+ * \brief Read monotonic clock
+ *
+ * \return Time in ns
+ */
+static uint64_t pv_getNs(void) {
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec);
+}
+#endif /* !defined(__x86_64__) && !defined(__i386__) */
+
+/**
+ * \brief Reference release time calculation (plain remainder)
+ *
+ * \param tskIdx Index of (due) task within task list
+ * \param tickCnt Relative system time tick count
+ *
+ * \return Release time
+ */
+static uint32_t pv_calcRelRef(const TKLsdlr_ctx_t* const me,
+                              const uint8_t tskIdx,
+                              const uint32_t tickCnt) {
+    const TKLtyp_tsk_t* const p_tsk = &me->p_tskLst[tskIdx];
+
+    return (tickCnt - ((tickCnt - p_tsk->lastRun) % p_tsk->period));
+}
+
+/**
+ * \brief Measure cycles per release time calculation
+ *
+ * \param tskIdx Index of task within task list
+ * \param isRef Whether to measure reference calculation
+ *
+ * \return Min. number of cycles per calculation (over all runs)
+ */
+static double pv_measure(const uint8_t tskIdx, const bool isRef) {
+    uint64_t cycMin = UINT64_MAX;
+
+    for (uint32_t run = 0u; BENCH_RUN_CNT > run; run++) {
+        uint32_t sum = 0u;
+        const uint64_t cycStart = BENCH_GET_CYC();
+
+        if (true == isRef) {
+            for (uint32_t i = 0u; BENCH_CASE_CNT > i; i++) {
+                sum += pv_calcRelRef(&pv_benchCtx, tskIdx, pv_tick[i]);
+            }
+        } else {
+            for (uint32_t i = 0u; BENCH_CASE_CNT > i; i++) {
+                sum += pv_calcRel(&pv_benchCtx, tskIdx, pv_tick[i]);
+            }
+        }
+
+        const uint64_t cyc = BENCH_GET_CYC() - cycStart;
+
+        pv_sink = sum;
+        if (cyc < cycMin) {
+            cycMin = cyc;
+        }
+    }
+
+    return ((double)cycMin / (double)BENCH_CASE_CNT);
+}
+
+/**
+ * \brief Benchmark one case
+ *
+ * \param p_name Name of case
+ * \param tskIdx Index of task within task list
+ * \param isLost Whether periods were lost (i.e., tick counts beyond the
+ * first period after `lastRun`)
+ */
+static void pv_benchCase(const char* const p_name,
+                         const uint8_t tskIdx,
+                         const bool isLost) {
+    const uint32_t period = pv_tskLst[tskIdx].period;
+
+    for (uint32_t i = 0u; BENCH_CASE_CNT > i; i++) {
+        const uint32_t rnd = ((uint32_t)rand() << 16u) ^ (uint32_t)rand();
+
+        pv_tick[i] = (true == isLost) ?
+                     ((2u * period) + (rnd % (UINT32_MAX - (2u * period)))) :
+                     (period + (rnd % period));
+    }
+
+    const double cycRef = pv_measure(tskIdx, true);
+    const double cyc = pv_measure(tskIdx, false);
+
+    printf("%-28s %10.1f %15.1f\n", p_name, cycRef, cyc);
+}
+
+/**
+ * \brief Verify release time calculation against reference for random tasks
+ * and tick counts (incl. rollover and power of 2 periods)
+ *
+ * \return Number of mismatches
+ */
+static uint32_t pv_verify(void) {
+    static TKLtyp_tsk_t tskLst[TKLSDLRCFG_TSK_CNT_MAX];
+    uint32_t mismatchCnt = 0u;
+
+    for (uint32_t n = 0u; VERIFY_CNT > n; n += TKLSDLRCFG_TSK_CNT_MAX) {
+        for (uint8_t i = 0u; TKLSDLRCFG_TSK_CNT_MAX > i; i++) {
+            const uint32_t rnd = ((uint32_t)rand() << 16u) ^ (uint32_t)rand();
+            const uint8_t width = (uint8_t)(1 + (rand() % 32));
+            uint32_t period = rnd >> (32u - width);
+
+            if (0 == (rand() % 4)) { /* Power of 2 period? */
+                period = (uint32_t)1u << (width - 1u);
+            }
+            period = (0u == period) ? 1u : period;
+
+            const TKLtyp_tsk_t tsk = {.active = true,
+                                      .period = period,
+                                      .deadline = 1u,
+                                      .lastRun = ((uint32_t)rand() << 16u) ^
+                                                 (uint32_t)rand(),
+                                      .p_tskRunner = &pv_tskRunner};
+
+            (void)memcpy(&tskLst[i], &tsk, sizeof(tsk));
+        }
+
+        TKLsdlr_ctxSetTskLst(&pv_benchCtx, tskLst, TKLSDLRCFG_TSK_CNT_MAX);
+
+        for (uint8_t i = 0u; TKLSDLRCFG_TSK_CNT_MAX > i; i++) {
+            const uint32_t period = tskLst[i].period;
+            const uint32_t rnd = ((uint32_t)rand() << 16u) ^ (uint32_t)rand();
+            /* Time since last run in `[period, 2^32 - 1]`, biased towards
+               small multiples of period */
+            const uint32_t tickSinceLastRun =
+                (0 == (rand() % 2)) ?
+                (period + (rnd % (UINT32_MAX - period + 1u))) :
+                (period * (1u + (rnd % 4u)) + (rnd % period));
+            const uint32_t tickCnt = tskLst[i].lastRun + tickSinceLastRun;
+
+            if ((tickSinceLastRun >= period) &&
+                (pv_calcRel(&pv_benchCtx, i, tickCnt) !=
+                 pv_calcRelRef(&pv_benchCtx, i, tickCnt))) {
+                mismatchCnt++;
+            }
+        }
+    }
+
+    return (mismatchCnt);
+}
+
+int main(void) {
+    srand(1u);
+
+    TKLsdlr_ctxInit(&pv_benchCtx);
+    TKLsdlr_ctxSetTskLst(&pv_benchCtx, pv_tskLst, 2u);
+
+    printf("Release time calculation, cycles per call (reciprocals %s)\n",
+           (0 != TKLSDLRCFG_REL_RECIP_ENA) ? "enabled" : "disabled");
+    printf("%-28s %10s %15s\n", "case", "remainder", "division-free");
+    pv_benchCase("no period lost", 1u, false);
+    pv_benchCase("periods lost, power of 2", 0u, true);
+    pv_benchCase("periods lost, other period", 1u, true);
+
+    const uint32_t mismatchCnt = pv_verify();
+
+    printf("verification: %lu mismatches\n", (unsigned long)mismatchCnt);
+
+    return ((0u == mismatchCnt) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
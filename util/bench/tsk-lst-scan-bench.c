@@ -0,0 +1,191 @@
+/**
+ * \file
+ *
+ * \brief Cycle count benchmark of the task list scan with array-of-structures
+ * and structure-of-arrays (hot/cold split) task list layout
+ *
+ * Runs execution cycles in which no task is due (i.e., the whole task list is
+ * scanned) round-robin over many scheduler instances with full task lists, so
+ * that all task lists together exceed the data caches, and prints the task
+ * list size, the part of it that the scan touches and the cycles per scanned
+ * task.  With the structure-of-arrays layout, the (`const`) cold array can be
+ * placed in flash memory on MCUs that map `const` data there.
+ *
+ * Build and run on a POSIX host (from the repository root), once with each
+ * layout:
+ *
+ *     gcc -std=c99 -O2 -Isrc -Iutil/bench util/bench/tsk-lst-scan-bench.c \
+ *         src/TKLsdlr.c -o tsk-lst-scan-bench && ./tsk-lst-scan-bench
+ *     gcc -std=c99 -O2 -Isrc -Iutil/bench -DTKLSDLRCFG_TSK_SOA_ENA=1 \
+ *         util/bench/tsk-lst-scan-bench.c src/TKLsdlr.c \
+ *         -o tsk-lst-scan-bench && ./tsk-lst-scan-bench
+ *
+ * Cycles are read via the time stamp counter on x86 and approximated via
+ * `CLOCK_MONOTONIC` (in ns) elsewhere (see `util/bench/rel-calc-bench.c`).
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "TKLsdlr.h"
+
+/* ATTRIBUTES
+ * ==========
+ */
+
+#ifndef BENCH_GET_CYC
+#if defined(__x86_64__) || defined(__i386__)
+/** \brief Read cycle counter */
+#define BENCH_GET_CYC() __builtin_ia32_rdtsc()
+#else
+#define BENCH_GET_CYC() pv_getNs()
+#endif /* defined(__x86_64__) || defined(__i386__) */
+#endif /* BENCH_GET_CYC */
+
+/** \brief Number of scheduler instances (task lists) */
+#ifndef BENCH_INST_CNT
+#define BENCH_INST_CNT 256u
+#endif /* BENCH_INST_CNT */
+
+/** \brief Number of tasks per task list */
+#define BENCH_TSK_CNT 255u
+
+/** \brief Number of rounds over all scheduler instances (min. is taken) */
+#define BENCH_RUN_CNT 16u
+
+/** \brief Task runner (never run) */
+static void pv_tskRunner(void) {
+    /* Do nothing */
+}
+
+/** \brief Scheduler instances */
+static TKLsdlr_ctx_t pv_benchCtx[BENCH_INST_CNT];
+
+#if TKLSDLRCFG_TSK_SOA_ENA
+/** \{ \brief Task lists (structure-of-arrays) */
+static TKLtyp_tskHot_t pv_hot[BENCH_INST_CNT][BENCH_TSK_CNT];
+static volatile bool pv_active[BENCH_INST_CNT][BENCH_TSK_CNT];
+static TKLtyp_tskCold_t pv_cold[BENCH_INST_CNT][BENCH_TSK_CNT];
+static TKLtyp_tskLstSoa_t pv_tskLst[BENCH_INST_CNT];
+/** \} */
+#else
+/** \brief Task lists (array-of-structures) */
+static TKLtyp_tsk_t pv_tskLst[BENCH_INST_CNT][BENCH_TSK_CNT];
+#endif /* TKLSDLRCFG_TSK_SOA_ENA */
+
+/* OPERATIONS
+ * ==========
+ */
+
+#if !defined(__x86_64__) && !defined(__i386__)
+/**
+ * \brief Read monotonic clock
+ *
+ * \return Time in ns
+ */
+static uint64_t pv_getNs(void) {
+    struct timespec now;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (((uint64_t)now.tv_sec * 1000000000u) + (uint64_t)now.tv_nsec);
+}
+#endif /* !defined(__x86_64__) && !defined(__i386__) */
+
+/**
+ * \brief Time tick count query (time stands still, so no task gets due)
+ *
+ * \return Time tick count
+ */
+static TKLtyp_tick_t pv_getTick(void) {
+    return (0u);
+}
+
+/**
+ * \brief Fill task lists (periods in `[2, 1001]`, no task due at tick `0`)
+ * and register them with scheduler instances
+ */
+static void pv_initTskLst(void) {
+    for (uint32_t n = 0u; BENCH_INST_CNT > n; n++) {
+        for (uint8_t i = 0u; BENCH_TSK_CNT > i; i++) {
+            const uint32_t period = 2u + ((uint32_t)rand() % 1000u);
+#if TKLSDLRCFG_TSK_SOA_ENA
+            const TKLtyp_tskHot_t hot = {.period = period, .lastRun = 0u};
+            const TKLtyp_tskCold_t cold = {.deadline = period,
+                                           .p_tskRunner = &pv_tskRunner};
+
+            (void)memcpy(&pv_hot[n][i], &hot, sizeof(hot));
+            (void)memcpy(&pv_cold[n][i], &cold, sizeof(cold));
+            pv_active[n][i] = (0 != (rand() % 4));
+#else
+            const TKLtyp_tsk_t tsk = {.active = (0 != (rand() % 4)),
+                                      .period = period,
+                                      .deadline = period,
+                                      .lastRun = 0u,
+                                      .p_tskRunner = &pv_tskRunner};
+
+            (void)memcpy(&pv_tskLst[n][i], &tsk, sizeof(tsk));
+#endif /* TKLSDLRCFG_TSK_SOA_ENA */
+        }
+
+        TKLsdlr_ctxInit(&pv_benchCtx[n]);
+        TKLsdlr_ctxSetTickSrc(&pv_benchCtx[n], &pv_getTick);
+#if TKLSDLRCFG_TSK_SOA_ENA
+        {
+            const TKLtyp_tskLstSoa_t tskLst = {.p_hot = pv_hot[n],
+                                               .p_active = pv_active[n],
+                                               .p_cold = pv_cold[n]};
+
+            (void)memcpy(&pv_tskLst[n], &tskLst, sizeof(tskLst));
+        }
+        TKLsdlr_ctxSetTskLst(&pv_benchCtx[n], &pv_tskLst[n], BENCH_TSK_CNT);
+#else
+        TKLsdlr_ctxSetTskLst(&pv_benchCtx[n], pv_tskLst[n], BENCH_TSK_CNT);
+#endif /* TKLSDLRCFG_TSK_SOA_ENA */
+    }
+}
+
+int main(void) {
+#if TKLSDLRCFG_TSK_SOA_ENA
+    const size_t scanSize = sizeof(TKLtyp_tskHot_t) + sizeof(bool);
+    const size_t tskSize = scanSize + sizeof(TKLtyp_tskCold_t);
+#else
+    const size_t scanSize = sizeof(TKLtyp_tsk_t);
+    const size_t tskSize = sizeof(TKLtyp_tsk_t);
+#endif /* TKLSDLRCFG_TSK_SOA_ENA */
+    uint64_t cycMin = UINT64_MAX;
+
+    srand(1u);
+    pv_initTskLst();
+
+    for (uint32_t run = 0u; BENCH_RUN_CNT > run; run++) {
+        const uint64_t cycStart = BENCH_GET_CYC();
+
+        for (uint32_t n = 0u; BENCH_INST_CNT > n; n++) {
+            TKLsdlr_ctxExec(&pv_benchCtx[n]);
+        }
+
+        const uint64_t cyc = BENCH_GET_CYC() - cycStart;
+
+        if (cyc < cycMin) {
+            cycMin = cyc;
+        }
+    }
+
+    printf("Task list scan (%s layout), %u task lists with %u tasks each\n",
+           (0 != TKLSDLRCFG_TSK_SOA_ENA) ? "structure-of-arrays" :
+                                           "array-of-structures",
+           (unsigned int)BENCH_INST_CNT,
+           (unsigned int)BENCH_TSK_CNT);
+    printf("bytes per task: %u (scanned: %u)\n",
+           (unsigned int)tskSize,
+           (unsigned int)scanSize);
+    printf("cycles per scanned task: %.2f\n",
+           (double)cycMin / (double)(BENCH_INST_CNT * BENCH_TSK_CNT));
+
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,86 @@
+# CPU load comparison
+# ===================
+#
+# Compares the CPU load measured at run time by the scheduler
+# (`TKLSDLRCFG_LOAD_ENA`, see `cpu-load-template.csv`) with the CPU
+# utilization predicted by `dms-sched-cpu-load.py` from the timing table
+# (`CPU util. in %` column, i.e. WCET divided by period).
+#
+# Only cooperative (`co`) tasks are run by the scheduler, so only they are
+# compared, in timing table order, which must be the task list order.
+# Preemptive (`pe`) tasks (ISRs) are not measured separately; their time is
+# accounted as busy if it falls within a task run and as idle otherwise.
+#
+# As the prediction is based on WCETs, measured CPU loads are expected to be
+# lower.  A measured CPU load above its prediction indicates an underestimated
+# WCET in the timing table.
+
+import argparse
+import csv
+import sys
+
+# Read CSV file into list of dicts (skip comments)
+def readCsv(fileName):
+    with open(fileName, newline='') as f:
+        rows = [row for row in csv.reader(f, skipinitialspace=True)
+                if row and not row[0].startswith('#')]
+    head = [elem.strip() for elem in rows[0]]
+    return [dict(zip(head, [elem.strip() for elem in row]))
+            for row in rows[1:]]
+
+# Handle positional and optional arguments
+parser = argparse.ArgumentParser(description='Compare measured CPU load CSV \
+                                 input file against CPU utilization predicted \
+                                 from timing table CSV input file')
+parser.add_argument('-m', '--margin', type=float,
+                    help='Margin in %% points by which a measured CPU load may \
+                    exceed its prediction (if exceeded, script returns \
+                    non-zero exit code, e.g. for CI purposes)')
+parser.add_argument('timingTableFile', help='Timing table CSV input file')
+parser.add_argument('cpuLoadFile', help='Measured CPU load CSV input file')
+args = parser.parse_args()
+
+# Predicted CPU utilization per cooperative task (in %), as calculated by
+# `dms-sched-cpu-load.py`
+tsk = [{'name': row['Task'],
+        'pred': float(row['WCET in s']) * float(row['Freq. in Hz']) * 100}
+       for row in readCsv(args.timingTableFile) if row['Sched.'] == 'co']
+
+# Measured CPU load per task (in %) and in total
+meas = {row['Task']: float(row['CPU load in %'])
+        for row in readCsv(args.cpuLoadFile)}
+if len(meas) != len(tsk) + 1 or 'total' not in meas:
+    print('Measured CPU load must contain ' + str(len(tsk))
+          + ' tasks (same as cooperative tasks in timing table) and total')
+    sys.exit(1)
+
+# Compare per task and in total
+res = []
+for idx, elem in enumerate(tsk):
+    res.append([str(idx) + ' ' + elem['name'], elem['pred'],
+                meas[str(idx)]])
+res.append(['total', sum(elem['pred'] for elem in tsk), meas['total']])
+
+# Print comparison table
+print('{:<24} {:>12} {:>12} {:>12}'.format('Task', 'Pred. in %',
+                                            'Meas. in %', 'Diff. in %'))
+exceedCnt = 0
+for name, pred, measVal in res:
+    diff = measVal - pred
+    exceed = args.margin is not None and diff > args.margin
+    exceedCnt += exceed
+    print('{:<24} {:>12.3f} {:>12.3f} {:>+12.3f}{}'.format(
+        name, pred, measVal, diff, ' <= exceeds prediction' if exceed else ''))
+
+# If margin argument is provided ...
+if args.margin is not None:
+    # Use non-zero exit code if any measurement exceeds its prediction.
+    # This allows for easy employment in continuous integration systems.
+    if exceedCnt == 0:
+        print('\n=> Measured CPU load matches prediction')
+        sys.exit(0)
+    else:
+        print('\n=> Measured CPU load exceeds prediction (check WCETs)')
+        sys.exit(1)
+
+sys.exit(0)
@@ -30,6 +30,9 @@
 #     20, No. 1, 1973-01-01, pp. 46--61; C. L. Liu, J. W. Layland)
 # [2] *Finding Response Times in a Real-Time System* (The Computer Journal,
 #     Vol. 29, No. 5, 1986; M. Joseph, P. Pandya)
+# [3] *Preemptive and Non-Preemptive Real-Time Uni-Processor Scheduling*
+#     (INRIA Research Report No. 2966, 1996; L. George, N. Rivierre,
+#     M. Spuri)
 
 import argparse
 import pandas as pd
@@ -39,6 +42,14 @@ import sys
 # WCRT calc. iteration limit after which no convergence is assumed
 convTryLim = 50
 
+# Busy period calc. iteration limit (EDF) after which no convergence is assumed
+busyPeriodTryLim = 100000
+
+# Return largest integer `n` with `n * y <= x` (robust against floating point
+# rounding of exact multiples)
+def floorDiv(x, y):
+    return math.floor(x / y + 1e-9)
+
 # Return function handle of argument type function for ArgumentParser checking
 # float range: min <= arg <= max
 def floatRange(min, max):
@@ -69,6 +80,13 @@ parser.add_argument('-t', '--timeTick', type=floatRange(0.0, 10.0),
 parser.add_argument('-l', '--cpuLoadLim', type=floatRange(0.0, 100.0),
                     help='CPU load limit in %% (if exceeded, script returns \
                     non-zero exit code, e.g. for CI purposes)')
+parser.add_argument('-e', '--edf', action='store_true',
+                    help='Analyze non-preemptive EDF scheduling policy \
+                    (`TKLSDLRCFG_EDF_ENA`) instead of DMS (only for \
+                    cooperative tasks)')
+parser.add_argument('-c', '--chainFile',
+                    help='CSV input file with task chains \
+                    (`TKLSDLRCFG_CHAIN_ENA`) to calc. their end-to-end latency')
 parser.add_argument('inputFile', help='CSV input file')
 parser.add_argument('outputFileBase', help='MD output file base name')
 args = parser.parse_args()
@@ -83,6 +101,34 @@ df = pd.read_csv(args.inputFile, skipinitialspace=True, comment='#')
 # Print read input for visual confirmation
 print(df.to_string())
 
+# Merge task chains
+#
+# The consumers of a chain are run back-to-back right after their producers,
+# without any other task in between.
+# For the analysis, a chain is therefore one task (its head task) with the sum
+# of the WCETs of all its tasks; the consumers are removed from the timing
+# table.
+# The WCRT of this task is then the chain's end-to-end latency.
+chainWcet = {}
+if args.chainFile:
+    chains = pd.read_csv(args.chainFile, skipinitialspace=True, comment='#')
+    print(chains.to_string())
+
+    for idx, head in enumerate(chains['Head']):
+        cons = chains['Consumers'].loc[idx].split()
+        chainTsk = df[df['Task'].isin([head] + cons)]
+
+        # Each task of a chain must exist (and be within one chain only) and be
+        # run by the Taskuler
+        if len(chainTsk.index) != 1 + len(cons) \
+           or 'pe' in list(chainTsk['Sched.']):
+            print('\nInvalid tasks in chain ' + str(chains['Chain'].loc[idx]))
+            sys.exit(1)
+
+        chainWcet[head] = df.loc[df['Task'].isin(cons), 'WCET in s'].sum()
+        df.loc[df['Task'] == head, 'WCET in s'] += chainWcet[head]
+        df = df[~df['Task'].isin(cons)]
+
 # Sort timing table by deadline
 # "Mergesort" algorithm is used as it only changes the order if necessary.
 # Tasks with equal deadlines stay in the same (maybe intentional) order as in
@@ -112,11 +158,13 @@ cpuLoad = df['CPU util. in %'].sum()
 # OBJECTIVE 2 - Calculate WCRT
 # ----------------------------
 #
-# Depending on the scheduling strategy, two different WCRT calculation
+# Depending on the scheduling strategy, three different WCRT calculation
 # algorithms must be employed:
 #
 # * ALGORITHM 1 - Taskuler with only cooperative tasks,
-# * ALGORITHM 2 - Taskuler augmented with (nested) interrupts.
+# * ALGORITHM 2 - Taskuler augmented with (nested) interrupts,
+# * ALGORITHM 3 - Taskuler with only cooperative tasks and EDF scheduling
+#   policy.
 #
 # Algorithm 2 gives an upper boundary (worst-case), and therefore can also be
 # used for systems without interrupt priorization (no nesting).
@@ -130,6 +178,92 @@ cpuLoad = df['CPU util. in %'].sum()
 # in order to decide which algorithm to employ
 schedule = df['Sched.'].value_counts()
 
+# ALGORITHM 3 - Taskuler with only cooperative tasks and EDF scheduling policy
+#
+# The Taskuler runs the due task with the earliest absolute deadline, i.e. it
+# is a non-preemptive EDF scheduler.  The WCRT of a task is the max. response
+# time of its job released at time `a` within the longest busy period, over
+# all relevant `a` (as per [3], with time in seconds instead of time ticks).
+#
+# This algorithm consists of STEPs 1--3.
+if args.edf and 'co' in schedule and 'pe' not in schedule:
+    print('\nWCRT calc. for cooperative tasks (non-preemptive EDF) ...\n')
+    wcet = list(df['WCET in s'])
+    period = list(df['Period in s'])
+    deadline = list(df['Deadline in s'])
+    wcrt = []
+
+    if cpuLoad >= 100:
+        # No busy period bound, i.e. not schedulable
+        wcrt = [math.inf] * len(wcet)
+    else:
+        # STEP 1 - Calculate (an upper bound of) the length of the longest busy
+        # period, incl. blocking by the longest WCET
+        busyPeriod = max(wcet) + sum(wcet)
+        busyPeriodPrev = 0
+        convTryCnt = 0
+        while busyPeriod != busyPeriodPrev:
+            busyPeriodPrev = busyPeriod
+            busyPeriod = max(wcet)
+            for wcetJ, periodJ in zip(wcet, period):
+                busyPeriod += math.ceil(busyPeriodPrev / periodJ - 1e-9) * wcetJ
+            if convTryCnt >= busyPeriodTryLim:
+                print('\nNo convergence in EDF busy period calc. after '
+                      + str(busyPeriodTryLim) + ' iterations.')
+                sys.exit(1)
+            else:
+                convTryCnt += 1
+
+        for i in range(len(wcet)): # For each task: ...
+
+            # ... STEP 2 - Find all release times `a` within busy period at
+            # which the task’s absolute deadline coincides with the one of a
+            # job of any task
+            relTimes = {0.0}
+            for periodJ, deadlineJ in zip(period, deadline):
+                k = 0
+                while k * periodJ + deadlineJ - deadline[i] < busyPeriod:
+                    a = k * periodJ + deadlineJ - deadline[i]
+                    if a >= 0:
+                        relTimes.add(a)
+                    k += 1
+
+            # ... STEP 3 - For each release time `a`, calculate the start time
+            # of the task’s job as fixed point of: blocking by the one longest
+            # WCET of all tasks with later absolute deadline (minus the time of
+            # 1 time tick), plus the task’s own earlier jobs, plus all jobs of
+            # other tasks with earlier or equal absolute deadline that are
+            # released until the start time.  Take the max. response time.
+            wcrtTmp = wcet[i]
+            for a in sorted(relTimes):
+                absDeadline = a + deadline[i]
+                blocking = max([0] + [wcet[j] - args.timeTick
+                                      for j in range(len(wcet))
+                                      if deadline[j] > absDeadline])
+                startPrev = -1
+                start = blocking + floorDiv(a, period[i]) * wcet[i]
+                convTryCnt = 0
+                while start != startPrev:
+                    startPrev = start
+                    start = blocking + floorDiv(a, period[i]) * wcet[i]
+                    for j in range(len(wcet)):
+                        if j != i and deadline[j] <= absDeadline:
+                            start += min(1 + floorDiv(startPrev, period[j]),
+                                         1 + floorDiv(absDeadline
+                                                      - deadline[j],
+                                                      period[j])) * wcet[j]
+                    if convTryCnt >= convTryLim:
+                        print('\nNo convergence in EDF WCRT calc. for '
+                              + df['Task'].loc[i] + ' after '
+                              + str(convTryLim) + ' iterations.')
+                        sys.exit(1)
+                    else:
+                        convTryCnt += 1
+                wcrtTmp = max(wcrtTmp, start + wcet[i] - a)
+
+            wcrt.append(wcrtTmp)
+    df['WCRT in s'] = wcrt
+
 # ALGORITHM 1 - Taskuler with only cooperative tasks
 #
 # The Taskuler is used to schedule all tasks without augmentation by
@@ -138,7 +272,7 @@ schedule = df['Sched.'].value_counts()
 # normally implemented via an interrupt.
 #
 # This algorithm consists of STEPs 1--3.
-if 'co' in schedule and 'pe' not in schedule:
+elif not args.edf and 'co' in schedule and 'pe' not in schedule:
     print('\nWCRT calc. for cooperative tasks ...\n')
     wcrt = []
     for idx, wcet in enumerate(df['WCET in s']): # For each task: ...
@@ -162,7 +296,7 @@ if 'co' in schedule and 'pe' not in schedule:
 # interrupts for the scheduling of some high priority tasks.
 #
 # This algorithm consists of STEPs 1--4.3.
-elif 'co' in schedule and 'pe' in schedule:
+elif not args.edf and 'co' in schedule and 'pe' in schedule:
     print('\nWCRT calc. for cooperative and preemptive tasks (with priority;')
     print('  nested interrupts) ...\n')
 
@@ -254,9 +388,29 @@ elif 'co' in schedule and 'pe' in schedule:
     # Sort by deadline
     df.sort_values(by=['Prio.'], inplace=True)
     df = df.reset_index(drop=True)
+elif args.edf:
+    print('EDF WCRT calc. only for cooperative tasks')
+    sys.exit(1)
 else:
     print('Invalid mix of co/pe')
 
+# Add chain end-to-end latency and deadline overrun/violation columns, count
+# all violations (`True`s), and restore WCET and WCRT of each head task (its
+# CPU utilization still includes its consumers)
+chainOverrunCnt = 0
+if args.chainFile:
+    chains['E2E latency in s'] = [df.loc[df['Task'] == head,
+                                         'WCRT in s'].iloc[0]
+                                  for head in chains['Head']]
+    chains['E2E deadline overrun?'] = chains['E2E deadline in s'] \
+                                      < chains['E2E latency in s']
+    chainOverrunCnt = chains['E2E deadline overrun?'].sum()
+    print('\n' + chains.to_string())
+
+    for head, wcet in chainWcet.items():
+        df.loc[df['Task'] == head, 'WCET in s'] -= wcet
+        df.loc[df['Task'] == head, 'WCRT in s'] -= wcet
+
 # Add deadline overrun/violation column and count all violations (`True`s)
 df['Deadline overrun?'] = df['Deadline in s'] < df['WCRT in s']
 deadlineOverrunCnt = df['Deadline overrun?'].sum()
@@ -267,6 +421,8 @@ print(df.to_string())
 # Create table with the result summary
 res = pd.DataFrame({'Objective': ['Deadline overruns', 'Total CPU load'],
                     'Value': [str(deadlineOverrunCnt), str(cpuLoad) + ' %']})
+if args.chainFile:
+    res.loc[len(res.index)] = ['Chain deadline overruns', str(chainOverrunCnt)]
 
 # Print schedulability result (table with the result summary)
 print('\n' + res.to_string(index=False))
@@ -282,11 +438,16 @@ pd.concat([df['Task'], df.loc[:,'Period in s':]],
 # Write final Markdown result timing table
 res.to_markdown(buf=args.outputFileBase + '-res.md', index=False)
 
+# Write final Markdown chain table
+if args.chainFile:
+    chains.to_markdown(buf=args.outputFileBase + '-chain.md', index=False)
+
 # If CPU load limit argument is provided ...
 if args.cpuLoadLim:
     # Use non-zero exit code if schedulability is unfeasible.
     # This allows for easy employment in continuous integration systems.
-    if deadlineOverrunCnt == 0 and cpuLoad <= args.cpuLoadLim:
+    if deadlineOverrunCnt == 0 and chainOverrunCnt == 0 \
+       and cpuLoad <= args.cpuLoadLim:
         print('\n=> Schedulability seems feasible')
         sys.exit(0)
     else:
@@ -0,0 +1,142 @@
+# Release table generation
+# ========================
+#
+# Generates the precomputed static cyclic schedule (release table) of a task
+# list as C header file, to be registered with the scheduler via
+# `TKLsdlr_setRelTbl()` and executed via `TKLsdlr_execTbl()`.
+#
+# The release pattern of a task list with constant periods and offsets repeats
+# after its hyperperiod, the least common multiple of all task periods.
+# Within one hyperperiod, the release table lists every time tick at which at
+# least one task is released ("release slot"), together with a bit mask of all
+# tasks released at that time tick.
+# The scheduler walks these release slots by time instead of checking every
+# task for being due to run; the order in which released tasks are run (task
+# list order, i.e. priority) is still decided at run time, exactly as with
+# `TKLsdlr_exec()`.
+#
+# A task with period `p` and offset (time tick of first release) `o`, with
+# `0 <= o <= p`, is released at all time ticks `t` within the hyperperiod with
+# `t mod p = o mod p`.
+# Releases before the first release in the very first hyperperiod are filtered
+# at run time by the scheduler.
+
+import argparse
+import csv
+import math
+import os
+import sys
+
+# Max. number of tasks per release table (bits in `TKLtyp_relSlot_t.tskMask`)
+tskCntLim = 32
+
+# Handle positional and optional arguments
+parser = argparse.ArgumentParser(description='Generate release table (static \
+                                 cyclic schedule) C header file from CSV \
+                                 input file')
+parser.add_argument('-s', '--slotLim', type=int, default=4096,
+                    help='Max. number of release slots (if exceeded, script \
+                    returns non-zero exit code; default: 4096)')
+parser.add_argument('-w', '--tickWidth', type=int, default=32,
+                    choices=[16, 32, 64],
+                    help='Time tick width in bits (`TKLSDLRCFG_TICK_WIDTH`; \
+                    default: 32)')
+parser.add_argument('inputFile', help='CSV input file')
+parser.add_argument('outputFile', help='C header output file')
+args = parser.parse_args()
+
+# Read release table CSV input file (skip comments)
+with open(args.inputFile, newline='') as f:
+    rows = [row for row in csv.reader(f, skipinitialspace=True)
+            if row and not row[0].startswith('#')]
+tsk = [{'name': row[0].strip(), 'period': int(row[1]), 'offset': int(row[2])}
+       for row in rows[1:]] # Skip header row
+
+if not 0 < len(tsk) <= tskCntLim:
+    print('Number of tasks must be in range [1..' + str(tskCntLim) + ']')
+    sys.exit(1)
+if any(elem['period'] <= 0 for elem in tsk):
+    print('Periods must be positive')
+    sys.exit(1)
+
+# The scheduler handles larger offsets like time tick count rollovers
+if any(not 0 <= elem['offset'] <= elem['period'] for elem in tsk):
+    print('Offsets must be in range [0..period]')
+    sys.exit(1)
+
+# Hyperperiod is the least common multiple of all task periods
+hyperperiod = 1
+for elem in tsk:
+    hyperperiod = hyperperiod * elem['period'] \
+                  // math.gcd(hyperperiod, elem['period'])
+
+# At most half the time tick range, so that the scheduler can compute the
+# time until the first release of the next hyperperiod without wrapping
+if hyperperiod > 2 ** (args.tickWidth - 1) - 1:
+    print('Hyperperiod ' + str(hyperperiod) + ' exceeds half the ' +
+          str(args.tickWidth) + ' bit time tick range')
+    sys.exit(1)
+
+# Collect tasks released at each time tick within hyperperiod
+slot = {}
+for idx, elem in enumerate(tsk):
+    for tick in range(elem['offset'] % elem['period'], hyperperiod,
+                      elem['period']):
+        slot[tick] = slot.get(tick, 0) | (1 << idx)
+
+if len(slot) > args.slotLim:
+    print('Number of release slots ' + str(len(slot)) + ' exceeds limit '
+          + str(args.slotLim))
+    sys.exit(1)
+
+# Print result for visual confirmation
+print('Hyperperiod: ' + str(hyperperiod) + ' ticks')
+print('Release slots: ' + str(len(slot)))
+
+# Write C header file
+guard = os.path.basename(args.outputFile).upper().replace('.', '_')
+out = ['/** \\file */',
+       '',
+       '/* Generated by `util/rel-tbl-gen.py` from `'
+       + os.path.basename(args.inputFile) + '`; do not edit */',
+       '',
+       '#ifndef ' + guard,
+       '#define ' + guard,
+       '',
+       '#include "TKLtyp.h"',
+       '',
+       '/** \\brief Release slots within hyperperiod of ' + str(hyperperiod)
+       + ' ticks */',
+       'static const TKLtyp_relSlot_t pv_relSlot[] = {']
+for tick in sorted(slot):
+    names = ', '.join(tsk[idx]['name'] for idx in range(len(tsk))
+                      if slot[tick] & (1 << idx))
+    out.append('    {' + str(tick) + 'u, 0x' + format(slot[tick], '08X')
+               + 'u}, /* ' + names + ' */')
+out[-1] = out[-1].replace('}, /*', '} /*')
+out += ['};',
+        '',
+        '/** \\brief Period of each task */',
+        'static const TKLtyp_tick_t pv_relPeriod[] = {'
+        + ', '.join(str(elem['period']) + 'u' for elem in tsk) + '};',
+        '',
+        '/** \\brief Time of first release (offset) of each task */',
+        'static const TKLtyp_tick_t pv_relOffset[] = {'
+        + ', '.join(str(elem['offset']) + 'u' for elem in tsk) + '};',
+        '',
+        '/** \\brief Release table */',
+        'static const TKLtyp_relTbl_t pv_relTbl = {',
+        '    .hyperperiod = ' + str(hyperperiod) + 'u,',
+        '    .slotCnt = ' + str(len(slot)) + 'u,',
+        '    .p_slot = pv_relSlot,',
+        '    .tskCnt = ' + str(len(tsk)) + 'u,',
+        '    .p_period = pv_relPeriod,',
+        '    .p_offset = pv_relOffset',
+        '};',
+        '',
+        '#endif /* ' + guard + ' */',
+        '']
+with open(args.outputFile, 'w') as f:
+    f.write('\n'.join(out))
+
+sys.exit(0)
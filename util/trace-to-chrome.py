@@ -0,0 +1,106 @@
+# Trace conversion
+# ================
+#
+# Converts a dumped trace (see `trace-template.csv`) of the scheduler’s trace
+# ring buffer (`TKLSDLRCFG_TRACE_ENA`) to the Chrome trace event JSON format,
+# to be viewed as timeline, e.g. in Perfetto (https://ui.perfetto.dev) or
+# `chrome://tracing`.
+#
+# Each task is shown as a separate thread (track), with its runs as slices and
+# its releases, deadline overruns and enable/disable events as instant events.
+#
+# References
+# ----------
+#
+# [1] *Trace Event Format* (Google; N. Duca, D. Sinclair)
+
+import argparse
+import csv
+import json
+import sys
+
+# Event types by number (`TKLTYP_TRACE_...`) and name
+evtTyp = ['rel', 'start', 'end', 'overrun', 'ena', 'dis']
+
+# Instant event names
+evtName = {'rel': 'Release', 'overrun': 'Deadline overrun', 'ena': 'Enable',
+           'dis': 'Disable'}
+
+# Handle positional and optional arguments
+parser = argparse.ArgumentParser(description='Convert trace dump CSV input \
+                                 file to Chrome trace event JSON output file')
+parser.add_argument('-t', '--timeTick', type=float, default=1e-3,
+                    help='Seconds corresponding to one time tick (default: \
+                    1e-3)')
+parser.add_argument('-n', '--tskName',
+                    help='Comma-separated task names, in task list order \
+                    (default: task index)')
+parser.add_argument('-w', '--tickWidth', type=int, default=32,
+                    choices=[16, 32, 64],
+                    help='Time tick width in bits (`TKLSDLRCFG_TICK_WIDTH`; \
+                    default: 32)')
+parser.add_argument('inputFile', help='CSV input file')
+parser.add_argument('outputFile', help='JSON output file')
+args = parser.parse_args()
+
+tskName = args.tskName.split(',') if args.tskName else []
+
+# Read trace dump CSV input file (skip comments and header row)
+with open(args.inputFile, newline='') as f:
+    rows = [row for row in csv.reader(f, skipinitialspace=True)
+            if row and not row[0].startswith('#')][1:]
+
+out = []
+tsk = set()
+tickPrev = None
+tickAbs = 0
+for row in rows:
+    tick = int(row[0])
+    idx = int(row[1])
+    typ = row[2].strip()
+    typ = evtTyp[int(typ)] if typ.isdigit() else typ
+    if typ not in evtTyp:
+        print('Unknown event type ' + row[2])
+        sys.exit(1)
+
+    # Unwrap time tick count (events are not strictly ordered by time, e.g.
+    # releases are recorded at their ideal release time)
+    if tickPrev is not None:
+        tickAbs += ((tick - tickPrev + 2**(args.tickWidth - 1))
+                    % 2**args.tickWidth) - 2**(args.tickWidth - 1)
+    else:
+        tickAbs = tick
+    tickPrev = tick
+
+    evt = {'pid': 0, 'tid': idx,
+           'ts': round(tickAbs * args.timeTick * 1e6, 3)} # In us
+    if typ == 'start':
+        evt.update({'ph': 'B', 'name': tskName[idx] if idx < len(tskName)
+                    else 'Task ' + str(idx)})
+    elif typ == 'end':
+        evt.update({'ph': 'E'})
+    else:
+        evt.update({'ph': 'i', 's': 't', 'name': evtName[typ]})
+    out.append(evt)
+    tsk.add(idx)
+
+# Name process and threads (tracks)
+meta = [{'pid': 0, 'ph': 'M', 'name': 'process_name',
+         'args': {'name': 'Taskuler'}}]
+for idx in sorted(tsk):
+    meta.append({'pid': 0, 'tid': idx, 'ph': 'M', 'name': 'thread_name',
+                 'args': {'name': (tskName[idx] if idx < len(tskName)
+                                   else 'Task') + ' (#' + str(idx) + ')'}})
+    meta.append({'pid': 0, 'tid': idx, 'ph': 'M', 'name': 'thread_sort_index',
+                 'args': {'sort_index': idx}})
+
+# Print result for visual confirmation
+print('Events: ' + str(len(out)))
+print('Tasks: ' + str(len(tsk)))
+
+# Write JSON output file
+with open(args.outputFile, 'w') as f:
+    json.dump({'traceEvents': meta + out, 'displayTimeUnit': 'ms'}, f,
+              indent=1)
+
+sys.exit(0)